@@ -28,57 +28,183 @@ enum CodeType {
 
 // 10.6 Arguments Object
 Handle<ArgumentsObject> CreateArgumentsObject(
-  Handle<FunctionObject> func, const std::vector<Handle<JSValue>>& args,
+  Handle<FunctionObject> func, Span<Handle<JSValue>> args,
   Handle<EnvironmentRecord> env, bool strict
 ) {
   TEST_LOG("\033[2menter\033[0m CreateArgumentsObject");
   const std::vector<Handle<String>>& names = func.val()->FormalParameters();
-  int len = args.size();
-  Handle<JSObject> obj = ArgumentsObject::New(len);
-  int indx = len - 1;  // 10
-  std::set<std::u16string> mapped_names;
-  while (indx >= 0) {  // 11
-    bool is_accessor_desc = false;
-    if (!strict && (size_t)indx < names.size()) {  // 11.c
-      Handle<String> name = names[indx];
-      std::u16string name_str = name.val()->data();  // 11.c.i
-      if (mapped_names.find(name_str) == mapped_names.end()) {  // 11.c.ii
-        mapped_names.insert(name_str);
-        is_accessor_desc = true;
-        Handle<GetterSetter> gs = GetterSetter::New(env, name, true);
-        Handle<PropertyDescriptor> desc = PropertyDescriptor::New();
-        desc.val()->SetSet(gs);
-        desc.val()->SetGet(gs);
-        desc.val()->SetConfigurable(true);
-        obj.val()->named_properties()->SetRawArray(indx, desc.val());
+  size_t len = args.size();
+  Handle<ArgumentsObject> obj = ArgumentsObject::New(func, env, len);
+  for (size_t indx = 0; indx < len; ++indx) {  // 11.a & 11.b
+    StackPropertyDescriptor desc = StackPropertyDescriptor::NewDataDescriptor(
+      args[indx], true, true, true);
+    PropertyMap::Set(obj, String::New(indx), desc);
+  }
+  if (!strict) {  // 11.c
+    size_t num_mapped = std::min(len, names.size());
+    bool has_duplicated = func.val()->Code()->params_have_duplicated();
+    for (size_t indx = 0; indx < num_mapped; ++indx) {
+      // Only the last parameter of a name is mapped.
+      bool shadowed = false;
+      for (size_t j = indx + 1; has_duplicated && j < num_mapped && !shadowed; ++j)
+        shadowed = StringEqual(names[indx], names[j]);
+      if (shadowed)
+        continue;
+      if (indx < ArgumentsObject::kMaxNumMapped) {
+        obj.val()->Map(indx);
+      } else {
+        Handle<GetterSetter> gs = GetterSetter::New(env, names[indx], true);
+        StackPropertyDescriptor desc;
+        desc.SetSet(gs);
+        desc.SetGet(gs);
+        desc.SetConfigurable(true);
+        PropertyMap::Set(obj, String::New(indx), desc);
       }
     }
-    if (!is_accessor_desc) {
-      Handle<JSValue> val = args[indx];  // 11.a
-      Handle<PropertyDescriptor> desc = PropertyDescriptor::NewDataDescriptor(
-        val, true, true, true);
-      obj.val()->named_properties()->SetRawArray(indx, desc.val()); // 11.b
-    }
-    indx--;  // 11.d
-  }
-  if (!strict) {  // 13
-    AddValueProperty(obj, String::callee(), func, true, false, true);
+    // The object could outlive the call, so the env must not be reused.
+    if (num_mapped > 0)
+      env.val()->AddRefCount();
+    AddValueProperty(obj, String::callee(), func, true, false, true);  // 13
   } else {  // 14
     // TODO(zhuzilin) thrower
     Handle<JSValue> thrower = Undefined::Instance();
     StackPropertyDescriptor desc;
     desc.SetAccessorDescriptor(thrower, thrower, false, false);
-    PropertyMap::Set(Handle<PropertyMap>(obj.val()->named_properties()), String::caller(), desc);
-    PropertyMap::Set(Handle<PropertyMap>(obj.val()->named_properties()), String::callee(), desc);
+    PropertyMap::Set(obj, String::caller(), desc);
+    PropertyMap::Set(obj, String::callee(), desc);
   }
   TEST_LOG("\033[2mexit\033[0m CreateArgumentsObject");
   return obj;  // 15
 }
 
+// Many functions that refer to arguments only read it on some paths, so
+// the object is created when the binding is first read. Until then the
+// binding holds ArgumentsObject::Pending() and the call is kept here.
+class LazyArguments {
+ public:
+  LazyArguments(
+    Handle<FunctionObject> func, Handle<EnvironmentRecord> env,
+    Span<Handle<JSValue>> args, bool strict
+  ) : active_(func.val()->Code()->body()->arguments_binding() >= 0) {
+    if (active_)
+      frames_.emplace_back(Frame{func, env, args, strict});
+  }
+
+  ~LazyArguments() {
+    if (active_)
+      frames_.pop_back();
+  }
+
+  // A closure made in the call could still read the binding through eval
+  // after the call returns, so create the object while the arguments are
+  // here. Call after the context of the call is popped.
+  void MaterializeIfEscaped() {
+    if (!active_)
+      return;
+    Handle<EnvironmentRecord> env = frames_.back().env;
+    if (env.val()->ref_count() == 0)
+      return;
+    Handle<DeclarativeEnvironmentRecord> decl_env = static_cast<Handle<DeclarativeEnvironmentRecord>>(env);
+    HashMapV2::Entry* p = decl_env.val()->bindings()->GetEntry(String::arguments());
+    if (p != nullptr && p->val == ArgumentsObject::Pending())
+      Materialize(decl_env);
+  }
+
+  // Create the arguments object of the call running in env and put it in
+  // the binding.
+  static Handle<ArgumentsObject> Materialize(Handle<DeclarativeEnvironmentRecord> env) {
+    for (auto iter = frames_.rbegin(); iter != frames_.rend(); ++iter) {
+      if (iter->env.val() != env.val())
+        continue;
+      Handle<ArgumentsObject> obj = CreateArgumentsObject(iter->func, iter->args, env, iter->strict);
+      env.val()->bindings()->GetEntry(String::arguments())->val = obj.val();
+      return obj;
+    }
+    // The binding is only pending while its call is running.
+    ASSERT(false);
+    abort();
+  }
+
+ private:
+  struct Frame {
+    Handle<FunctionObject> func;
+    Handle<EnvironmentRecord> env;
+    Span<Handle<JSValue>> args;
+    bool strict;
+  };
+
+  bool active_;
+  static std::vector<Frame> frames_;
+};
+
+std::vector<LazyArguments::Frame> LazyArguments::frames_;
+
+// The bindings of a fresh call of `body`, all set to undefined. It is a
+// constant hashmap, as its keys are the constant names from the parser.
+HashMapV2* BindingTemplate(ProgramOrFunctionBody* body) {
+  if (body->binding_template() == nullptr) {
+    const std::vector<Handle<String>>& names = body->binding_names();
+    Handle<HashMapV2> bindings = HashMapV2::New<
+      DeclarativeEnvironmentRecord::kDefaultNumDecls, GCFlag::CONST>(names.size());
+    // The constant space is not 0ed.
+    bindings.val()->Clear();
+    auto entry_fn = [](HashMapV2::Entry* p) {
+      p->can_delete = false;
+      p->is_mutable = true;
+    };
+    // The capacity is enough for all names, so it is never resized into a
+    // non constant map.
+    for (Handle<String> name : names) {
+      bool created;
+      bindings = HashMapV2::Create(bindings, name, Undefined::Instance(), created, entry_fn);
+    }
+    body->SetBindingTemplate(bindings.val());
+  }
+  return body->binding_template();
+}
+
+// 10.5 for function code with the layout computed by the parser. The
+// bindings are copied from the template at once and then the parameters,
+// the functions and the arguments object are filled in by index. Return
+// false when the bindings of a reused env have a different capacity.
+bool InstantiateBindingTemplate(
+  Handle<Error>& e, ProgramOrFunctionBody* body, Handle<FunctionObject> f,
+  Span<Handle<JSValue>> args, bool strict
+) {
+  Handle<DeclarativeEnvironmentRecord> env = static_cast<Handle<DeclarativeEnvironmentRecord>>(
+    Runtime::TopContext().variable_env());
+  HashMapV2* binding_template = BindingTemplate(body);
+  if (env.val()->bindings()->capacity() != binding_template->capacity())
+    return false;
+  env.val()->bindings()->CopyFrom(binding_template);
+  // 4
+  const std::vector<uint32_t>& param_bindings = body->param_bindings();
+  HashMapV2::Entry* entries = env.val()->bindings()->map_start();
+  for (size_t i = 0; i < param_bindings.size(); ++i) {
+    entries[param_bindings[i]].val = i < args.size() ?
+      args[i].val() : Undefined::Instance().val();
+  }
+  // 5
+  const std::vector<Function*>& func_decls = body->func_decls();
+  for (size_t i = 0; i < func_decls.size(); ++i) {
+    Handle<FunctionObject> fo = InstantiateFunctionDeclaration(e, func_decls[i]);
+    if (unlikely(!e.val()->IsOk())) return true;
+    env.val()->bindings()->map_start()[body->func_decl_bindings()[i]].val = fo.val();
+  }
+  // 7, the object is created later, see LazyArguments.
+  if (body->arguments_binding() >= 0) {
+    HashMapV2::Entry* p = env.val()->bindings()->map_start() + body->arguments_binding();
+    p->val = ArgumentsObject::Pending();
+    p->is_mutable = !strict;  // 7.b & 7.c
+  }
+  // 8, the variables are already undefined.
+  return true;
+}
+
 // 10.5 Declaration Binding Instantiation
 void DeclarationBindingInstantiation(
   Handle<Error>& e, ProgramOrFunctionBody* body, CodeType code_type,
-  Handle<FunctionObject> f = Handle<FunctionObject>(), std::vector<Handle<JSValue>> args = {}
+  Handle<FunctionObject> f = Handle<FunctionObject>(), Span<Handle<JSValue>> args = {}
 ) {
   TEST_LOG("\033[2menter\033[0m DeclarationBindingInstantiation");
   Handle<EnvironmentRecord> env = Runtime::TopContext().variable_env(); // 1
@@ -87,6 +213,8 @@ void DeclarationBindingInstantiation(
     configurable_bindings = true;  // 2
   }
   bool strict = body->strict() || Runtime::TopContext().strict();  // 3
+  if (code_type == CODE_FUNC && InstantiateBindingTemplate(e, body, f, args, strict))
+    return;
   if (code_type == CODE_FUNC) {  // 4
     ASSERT(!f.IsNullptr());
     const std::vector<Handle<String>>& names = f.val()->FormalParameters();  // 4.a
@@ -200,7 +328,7 @@ void EnterGlobalCode(Handle<Error>& e, AST* ast) {
   if (program->strict()) {
     for (VarDecl* d : program->var_decls()) {
       if (d->is_strict_future()) {
-        e = Error::SyntaxError(u"Unexpected future reserved word " + d->ident().val()->data() + u" in strict mode");
+        e = Error::SyntaxError(u"Unexpected future reserved word ", d->ident(), u" in strict mode");
         return;
       }
       if (d->is_eval_or_arguments()) {
@@ -243,7 +371,7 @@ void EnterEvalCode(Handle<Error>& e, AST* ast) {
 
     for (VarDecl* d : program->var_decls()) {
       if (d->is_strict_future()) {
-        e = Error::SyntaxError(u"Unexpected future reserved word " + d->ident().val()->data() + u" in strict mode");
+        e = Error::SyntaxError(u"Unexpected future reserved word ", d->ident(), u" in strict mode");
         return;
       }
       if (d->is_eval_or_arguments()) {
@@ -262,7 +390,7 @@ void EnterEvalCode(Handle<Error>& e, AST* ast) {
 // 10.4.3
 void EnterFunctionCode(
   Handle<Error>& e, Handle<FunctionObject> func, ProgramOrFunctionBody* body,
-  Handle<JSValue> this_arg, std::vector<Handle<JSValue>> args, bool strict,
+  Handle<JSValue> this_arg, Span<Handle<JSValue>> args, bool strict,
   Handle<EnvironmentRecord> local_env
 ) {
   Handle<JSValue> this_binding;
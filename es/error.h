@@ -32,27 +32,61 @@ class Error : public JSValue {
   }
 
   static Handle<Error> EvalError() {
-    static Handle<Error> singleton = Error::New<E_EVAL, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(u"");
-    return singleton;
+    Handle<Error> error = Instance<E_EVAL>();
+    error.val()->SetMessage(u"", Handle<String>(), u"");
+    return error;
   }
 
-  static Handle<Error> RangeError(std::u16string message) {
-    static Handle<Error> singleton = Error::New<E_EVAL, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(message);
-    return singleton;
+  // The messages of the errors thrown by the runtime are only formatted when
+  // they are read, so a literal message or a message made of a literal
+  // prefix, a name and a literal suffix costs no string operations to throw.
+  // A message built by the caller is saved as is.
+  static Handle<Error> RangeError(const char16_t* message) {
+    return RangeError(message, Handle<String>());
   }
 
-  static Handle<Error> ReferenceError(std::u16string message) {
-    static Handle<Error> singleton = Error::New<E_REFERENCE, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(message);
-    return singleton;
+  static Handle<Error> RangeError(const char16_t* prefix, Handle<String> name, const char16_t* suffix = u"") {
+    Handle<Error> error = Instance<E_RANGE>();
+    error.val()->SetMessage(prefix, name, suffix);
+    return error;
   }
 
-  static Handle<Error> SyntaxError(std::u16string message) {
-    static Handle<Error> singleton = Error::New<E_SYNTAX, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(message);
-    return singleton;
+  static Handle<Error> RangeError(const std::u16string& message) {
+    Handle<Error> error = Instance<E_RANGE>();
+    error.val()->SetMessage(message);
+    return error;
+  }
+
+  static Handle<Error> ReferenceError(const char16_t* message) {
+    return ReferenceError(message, Handle<String>());
+  }
+
+  static Handle<Error> ReferenceError(const char16_t* prefix, Handle<String> name, const char16_t* suffix = u"") {
+    Handle<Error> error = Instance<E_REFERENCE>();
+    error.val()->SetMessage(prefix, name, suffix);
+    return error;
+  }
+
+  static Handle<Error> ReferenceError(const std::u16string& message) {
+    Handle<Error> error = Instance<E_REFERENCE>();
+    error.val()->SetMessage(message);
+    return error;
+  }
+
+  static Handle<Error> SyntaxError(const char16_t* message) {
+    return SyntaxError(message, Handle<String>());
+  }
+
+  static Handle<Error> SyntaxError(const char16_t* prefix, Handle<String> name, const char16_t* suffix = u"") {
+    Handle<Error> error = Instance<E_SYNTAX>();
+    error.val()->SetMessage(prefix, name, suffix);
+    return error;
+  }
+
+  static Handle<Error> SyntaxError(const std::u16string& message) {
+    Handle<Error> error = Instance<E_SYNTAX>();
+    error.val()->SetMessage(message);
+    return error;
   }
 
   // Only used in parser
@@ -64,29 +98,47 @@ class Error : public JSValue {
     return error;
   }
 
-  static Handle<Error> TypeError(std::u16string message = u"") {
-    static Handle<Error> singleton = Error::New<E_TYPE, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(message);
-    return singleton;
+  static Handle<Error> TypeError(const char16_t* message = u"") {
+    return TypeError(message, Handle<String>());
+  }
+
+  static Handle<Error> TypeError(const char16_t* prefix, Handle<String> name, const char16_t* suffix = u"") {
+    Handle<Error> error = Instance<E_TYPE>();
+    error.val()->SetMessage(prefix, name, suffix);
+    return error;
+  }
+
+  static Handle<Error> TypeError(const std::u16string& message) {
+    Handle<Error> error = Instance<E_TYPE>();
+    error.val()->SetMessage(message);
+    return error;
   }
 
   static Handle<Error> UriError() {
-    static Handle<Error> singleton = Error::New<E_URI, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetMessage(u"");
-    return singleton;
+    Handle<Error> error = Instance<E_URI>();
+    error.val()->SetMessage(u"", Handle<String>(), u"");
+    return error;
   }
 
   static Handle<Error> NativeError(Handle<JSValue> val) {
-    static Handle<Error> singleton = Error::New<E_NATIVE, GCFlag::SINGLE>(Handle<JSValue>());
-    singleton.val()->SetValue(val);
-    return singleton;
+    Handle<Error> error = Instance<E_NATIVE>();
+    error.val()->SetValue(val);
+    return error;
   }
 
   ErrorType error_type() { return READ_VALUE(this, kErrorTypeOffset, ErrorType); }
-  Handle<JSValue> value() { return READ_HANDLE_VALUE(this, kValueOffset, JSValue); }
-  void SetValue(Handle<JSValue> val) { SET_HANDLE_VALUE(this, kValueOffset, val, JSValue); }
+  // The message, or the thrown value of a native error.
+  Handle<JSValue> value() {
+    if (unlikely(has_pending_message()))
+      SetMessage(FormatMessage(message_prefix(), message_name().val(), message_suffix()));
+    return READ_HANDLE_VALUE(this, kValueOffset, JSValue);
+  }
+  void SetValue(Handle<JSValue> val) {
+    SET_VALUE(this, kMessagePrefixOffset, nullptr, const char16_t*);
+    SET_HANDLE_VALUE(this, kValueOffset, val, JSValue);
+  }
 
-  void SetMessage(std::u16string message) {
+  void SetMessage(const std::u16string& message) {
     if (message == u"") {
       SetValue(String::Empty());
     } else {
@@ -94,19 +146,49 @@ class Error : public JSValue {
     }
   }
 
+  // The parts of a message that is not formatted yet, the name is saved as
+  // the value.
+  bool has_pending_message() { return message_prefix() != nullptr; }
+  const char16_t* message_prefix() { return READ_VALUE(this, kMessagePrefixOffset, const char16_t*); }
+  const char16_t* message_suffix() { return READ_VALUE(this, kMessageSuffixOffset, const char16_t*); }
+  Handle<String> message_name() { return READ_HANDLE_VALUE(this, kValueOffset, String); }
+
+  static std::u16string FormatMessage(const char16_t* prefix, String* name, const char16_t* suffix) {
+    std::u16string message = prefix;
+    if (name != nullptr)
+      message += name->data();
+    message += suffix;
+    return message;
+  }
+
   bool IsOk() { return error_type() == E_OK; }
   bool IsNativeError() { return error_type() == E_NATIVE; }
 
+ private:
+  // The errors are singletons, so they are never moved.
+  template<ErrorType t>
+  static Handle<Error> Instance() {
+    static Handle<Error> singleton = Error::New<t, GCFlag::SINGLE>(Handle<JSValue>());
+    return singleton;
+  }
+
+  void SetMessage(const char16_t* prefix, Handle<String> name, const char16_t* suffix) {
+    SET_HANDLE_VALUE(this, kValueOffset, name, String);
+    SET_VALUE(this, kMessagePrefixOffset, prefix, const char16_t*);
+    SET_VALUE(this, kMessageSuffixOffset, suffix, const char16_t*);
+  }
+
  private:
   template<ErrorType t, flag_t flag = 0>
   static Handle<Error> New(Handle<JSValue> val) {
 #ifdef GC_DEBUG
     TEST_LOG("Error::New\n");
 #endif
-    Handle<JSValue> jsval = HeapObject::New<kUint32Size + kPtrSize, flag>();
+    Handle<JSValue> jsval = HeapObject::New<kUint32Size + 3 * kPtrSize, flag>();
 
     SET_VALUE(jsval.val(), kErrorTypeOffset, t, ErrorType);
     SET_HANDLE_VALUE(jsval.val(), kValueOffset, val, JSValue);
+    SET_VALUE(jsval.val(), kMessagePrefixOffset, nullptr, const char16_t*);
     jsval.val()->SetType(ERROR);
 
     return Handle<Error>(jsval);
@@ -115,6 +197,8 @@ class Error : public JSValue {
  public:
   static constexpr size_t kErrorTypeOffset = HeapObject::kHeapObjectOffset;
   static constexpr size_t kValueOffset = kErrorTypeOffset + kUint32Size;
+  static constexpr size_t kMessagePrefixOffset = kValueOffset + kPtrSize;
+  static constexpr size_t kMessageSuffixOffset = kMessagePrefixOffset + kPtrSize;
 };
 
 }  // namespace es
@@ -20,7 +20,7 @@ namespace es {
 Completion EvalProgram(AST* ast);
 
 Completion EvalStatement(AST* ast);
-Completion EvalStatementList(std::vector<AST*> statements);
+Completion EvalStatementList(const std::vector<AST*>& statements);
 Completion EvalBlockStatement(AST* ast);
 Handle<String> EvalVarDecl(Handle<Error>& e, AST* ast);
 Completion EvalVarStatement(AST* ast);
@@ -44,7 +44,7 @@ Handle<JSValue> EvalPrimaryExpression(Handle<Error>& e, AST* ast);
 Handle<JSValue> EvalExpressionAndGetValue(Handle<Error>& e, AST* ast);
 void EvalExpressionAndPutValue(Handle<Error>& e, AST* ast, Handle<JSValue> val);
 Handle<Reference> EvalIdentifier(AST* ast);
-Handle<JSValue> EvalIdentifierAndGetValue(Handle<Error>& e, AST* ast);
+Handle<JSValue> EvalIdentifierAndGetValue(Handle<Error>& e, AST* ast, Handle<JSValue>* this_value = nullptr);
 void EvalIdentifierAndPutValue(Handle<Error>& e, AST* ast, Handle<JSValue> val);
 Handle<Number> EvalNumber(AST* ast);
 Handle<String> EvalString(Handle<Error>& e, AST* ast);
@@ -63,10 +63,15 @@ Handle<JSValue> EvalLogicalOperator(Handle<Error>& e, Token& op, AST* lhs, AST*
 Handle<JSValue> EvalSimpleAssignment(Handle<Error>& e, Handle<JSValue> lref, Handle<JSValue> rval);
 Handle<JSValue> EvalTripleConditionExpression(Handle<Error>& e, AST* ast);
 Handle<JSValue> EvalLeftHandSideExpression(Handle<Error>& e, AST* ast);
-std::vector<Handle<JSValue>> EvalArgumentsList(Handle<Error>& e, Arguments* ast);
-Handle<JSValue> EvalCallExpression(Handle<Error>& e, Handle<JSValue> ref, std::vector<Handle<JSValue>> arg_list);
-Handle<Reference> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, Handle<String> identifier_name, ValueGuard& guard);
-Handle<JSValue> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, AST* expr, ValueGuard& guard);
+Handle<JSValue> EvalLeftHandSideExpressionAndGetValue(Handle<Error>& e, AST* ast);
+void EvalArgumentsList(Handle<Error>& e, Arguments* ast, ArgumentWindow& arg_list);
+Handle<JSValue> EvalCallExpression(
+  Handle<Error>& e, Handle<JSValue> ref, Handle<JSValue> func, Span<Handle<JSValue>> arg_list);
+Handle<JSValue> EvalCall(
+  Handle<Error>& e, Handle<JSValue> func, Handle<JSValue> this_value, Handle<String> ref_name,
+  Span<Handle<JSValue>> arg_list);
+Handle<Reference> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, Handle<String> identifier_name);
+Handle<JSValue> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, AST* expr);
 Handle<JSValue> EvalExpressionList(Handle<Error>& e, AST* ast);
 
 void IdentifierResolutionAndPutValue(Handle<Error>& e, Handle<String> name, Handle<JSValue> value);
@@ -74,7 +79,7 @@ void IdentifierResolutionAndPutValue(Handle<Error>& e, Handle<String> name, Hand
 Completion EvalProgram(AST* ast) {
   ASSERT(ast->type() == AST::AST_PROGRAM || ast->type() == AST::AST_FUNC_BODY);
   auto prog = static_cast<ProgramOrFunctionBody*>(ast);
-  auto statements = prog->statements();
+  const auto& statements = prog->statements();
   // 12.9 considered syntactically incorrect if it contains
   //      a return statement that is not within a FunctionBody.
   if (ast->type() != AST::AST_FUNC_BODY) {
@@ -83,15 +88,15 @@ Completion EvalProgram(AST* ast) {
         return Completion(
           Completion::THROW,
           Error::SyntaxError(u"return statement must exist in return statement."),
-          u"");
+          kEmptyLabel);
       }
     }
   }
 
   Completion head_result;
   if (statements.size() == 0)
-    return Completion(Completion::NORMAL, Handle<JSValue>(), u"");
-  for (auto stmt : prog->statements()) {
+    return Completion(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
+  for (auto stmt : statements) {
     if (head_result.IsAbruptCompletion())
       break;
     Completion tail_result = EvalStatement(stmt);
@@ -108,7 +113,7 @@ Completion EvalProgram(AST* ast) {
 
 Completion EvalStatement(AST* ast) {
   TEST_LOG("\033[1;33mEvalStatement\033[0m\n", ast->source(), "\n");
-  Completion C(Completion::NORMAL, Handle<JSValue>(), u"");
+  Completion C(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
   JSValue* val = nullptr;
   {
     HandleScope scope;
@@ -176,7 +181,7 @@ Completion EvalStatement(AST* ast) {
   return C;
 }
 
-Completion EvalStatementList(std::vector<AST*> statements) {
+Completion EvalStatementList(const std::vector<AST*>& statements) {
   Completion sl;
   for (auto stmt : statements) {
     Completion s = EvalStatement(stmt);
@@ -201,9 +206,7 @@ Handle<String> EvalVarDecl(Handle<Error>& e, AST* ast) {
   Handle<String> ident = decl->ident();
   if (decl->init() == nullptr)
     return ident;
-  Handle<JSValue> rhs = EvalExpression(e, decl->init());
-  if (unlikely(!e.val()->IsOk())) return ident;
-  Handle<JSValue> value = GetValue(e, rhs);
+  Handle<JSValue> value = EvalExpressionAndGetValue(e, decl->init());
   if (unlikely(!e.val()->IsOk())) return ident;
   IdentifierResolutionAndPutValue(e, ident, value);
   if (unlikely(!e.val()->IsOk())) return ident;
@@ -220,9 +223,9 @@ Completion EvalVarStatement(AST* ast) {
     EvalVarDecl(e, decl);
     if (unlikely(!e.val()->IsOk())) goto error;
   }
-  return Completion(Completion::NORMAL, Handle<JSValue>(), u"");
+  return Completion(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
 error:
-  return Completion(Completion::THROW, e, u"");
+  return Completion(Completion::THROW, e, kEmptyLabel);
 }
 
 Completion EvalIfStatement(AST* ast) {
@@ -231,13 +234,13 @@ Completion EvalIfStatement(AST* ast) {
   If* if_stmt = static_cast<If*>(ast);
   Handle<JSValue> expr = EvalExpressionAndGetValue(e, if_stmt->cond());
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   if (ToBoolean(expr)) {
     return EvalStatement(if_stmt->if_block());
   } else if (if_stmt->else_block() != nullptr){
     return EvalStatement(if_stmt->else_block());
   }
-  return Completion(Completion::NORMAL, Handle<JSValue>(), u"");
+  return Completion(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
 }
 
 // 12.6.1 The do-while Statement
@@ -254,9 +257,9 @@ Completion EvalDoWhileStatement(AST* ast) {
     stmt = EvalStatement(loop_stmt->stmt());
     switch (stmt.type()) {
       case Completion::BREAK: {
-        if (stmt.target() == ast->label() || stmt.target() == u"") {
+        if (stmt.target() == ast->label() || stmt.target() == kEmptyLabel) {
           Runtime::TopContext().ExitIteration();
-          return Completion(Completion::NORMAL, stmt.value(), u"");
+          return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
         }
         [[fallthrough]];
       }
@@ -266,7 +269,7 @@ Completion EvalDoWhileStatement(AST* ast) {
         return stmt;
       }
       case Completion::CONTINUE: {
-        if (stmt.target() != u"" && stmt.target() != ast->label()) {
+        if (stmt.target() != kEmptyLabel && stmt.target() != ast->label()) {
           Runtime::TopContext().ExitIteration();
           return stmt;
         }
@@ -281,10 +284,10 @@ Completion EvalDoWhileStatement(AST* ast) {
       break;
   }
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::NORMAL, stmt.value(), u"");
+  return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
 error:
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::THROW, e, u"");
+  return Completion(Completion::THROW, e, kEmptyLabel);
 }
 
 // 12.6.2 The while Statement
@@ -306,9 +309,9 @@ Completion EvalWhileStatement(AST* ast) {
     stmt = EvalStatement(loop_stmt->stmt());
     switch (stmt.type()) {
       case Completion::BREAK: {
-        if (stmt.target() == ast->label() || stmt.target() == u"") {
+        if (stmt.target() == ast->label() || stmt.target() == kEmptyLabel) {
           Runtime::TopContext().ExitIteration();
-          return Completion(Completion::NORMAL, stmt.value(), u"");
+          return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
         }
         [[fallthrough]];
       }
@@ -318,7 +321,7 @@ Completion EvalWhileStatement(AST* ast) {
         return stmt;
       }
       case Completion::CONTINUE: {
-        if (stmt.target() != u"" && stmt.target() != ast->label()) {
+        if (stmt.target() != kEmptyLabel && stmt.target() != ast->label()) {
           Runtime::TopContext().ExitIteration();
           return stmt;
         }
@@ -329,10 +332,10 @@ Completion EvalWhileStatement(AST* ast) {
     }
   }
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::NORMAL, stmt.value(), u"");
+  return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
 error:
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::THROW, e, u"");
+  return Completion(Completion::THROW, e, kEmptyLabel);
 }
 
 // 12.6.3 The for Statement
@@ -363,9 +366,9 @@ Completion EvalForStatement(AST* ast) {
     stmt = EvalStatement(for_stmt->statement());
     switch (stmt.type()) {
       case Completion::BREAK: {
-        if (stmt.target() == ast->label() || stmt.target() == u"") {
+        if (stmt.target() == ast->label() || stmt.target() == kEmptyLabel) {
           Runtime::TopContext().ExitIteration();
-          return Completion(Completion::NORMAL, stmt.value(), u"");
+          return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
         }
         [[fallthrough]];
       }
@@ -375,7 +378,7 @@ Completion EvalForStatement(AST* ast) {
         return stmt;
       }
       case Completion::CONTINUE: {
-        if (stmt.target() != u"" && stmt.target() != ast->label()) {
+        if (stmt.target() != kEmptyLabel && stmt.target() != ast->label()) {
           Runtime::TopContext().ExitIteration();
           return stmt;
         }
@@ -391,10 +394,10 @@ Completion EvalForStatement(AST* ast) {
     }
   }
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::NORMAL, stmt.value(), u"");
+  return Completion(Completion::NORMAL, stmt.value(), kEmptyLabel);
 error:
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::THROW, e, u"");
+  return Completion(Completion::THROW, e, kEmptyLabel);
 }
 
 // 12.6.4 The for-in Statement
@@ -404,6 +407,7 @@ Completion EvalForInStatement(AST* ast) {
   Runtime::TopContext().EnterIteration();
   ForIn* for_in_stmt = static_cast<ForIn*>(ast);
   Handle<JSObject> obj;
+  Handle<FixedArray> keys;
   Handle<JSValue> expr_ref;
   Handle<JSValue> expr_val;
   Completion stmt;
@@ -417,23 +421,25 @@ Completion EvalForInStatement(AST* ast) {
     if (unlikely(!e.val()->IsOk())) goto error;
     if (expr_val.val()->IsUndefined() || expr_val.val()->IsNull()) {
       Runtime::TopContext().ExitIteration();
-      return Completion(Completion::NORMAL, Handle<JSValue>(), u"");
+      return Completion(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
     }
     obj = ToObject(e, expr_val);
     if (unlikely(!e.val()->IsOk())) goto error;
 
-    for (Handle<String> P : obj.val()->AllEnumerableKeys()) {
+    keys = JSObject::ForInKeys(obj);
+    for (size_t i = 0; i < keys.val()->size(); ++i) {
+      Handle<String> P = static_cast<Handle<String>>(keys.val()->Get(i));
       IdentifierResolutionAndPutValue(e, var_name, P);
       if (unlikely(!e.val()->IsOk())) goto error;
 
       stmt = EvalStatement(for_in_stmt->statement());
       if (!stmt.IsEmpty())
         V = stmt.value();
-      has_label = stmt.target() == ast->label() || stmt.target() == u"";
+      has_label = stmt.target() == ast->label() || stmt.target() == kEmptyLabel;
       if (stmt.type() != Completion::CONTINUE || !has_label) {
         if (stmt.type() == Completion::BREAK && has_label) {
           Runtime::TopContext().ExitIteration();
-          return Completion(Completion::NORMAL, V, u"");
+          return Completion(Completion::NORMAL, V, kEmptyLabel);
         }
         if (stmt.IsAbruptCompletion()) {
           Runtime::TopContext().ExitIteration();
@@ -446,21 +452,23 @@ Completion EvalForInStatement(AST* ast) {
     if (unlikely(!e.val()->IsOk())) goto error;
     if (expr_val.val()->IsUndefined() || expr_val.val()->IsNull()) {
       Runtime::TopContext().ExitIteration();
-      return Completion(Completion::NORMAL, Handle<JSValue>(), u"");
+      return Completion(Completion::NORMAL, Handle<JSValue>(), kEmptyLabel);
     }
     obj = ToObject(e, expr_val);
-    for (Handle<String> P : obj.val()->AllEnumerableKeys()) {
+    keys = JSObject::ForInKeys(obj);
+    for (size_t i = 0; i < keys.val()->size(); ++i) {
+      Handle<String> P = static_cast<Handle<String>>(keys.val()->Get(i));
       EvalExpressionAndPutValue(e, for_in_stmt->expr0(), P);
       if (unlikely(!e.val()->IsOk())) goto error;
 
       stmt = EvalStatement(for_in_stmt->statement());
       if (!stmt.IsEmpty())
         V = stmt.value();
-      has_label = stmt.target() == ast->label() || stmt.target() == u"";
+      has_label = stmt.target() == ast->label() || stmt.target() == kEmptyLabel;
       if (stmt.type() != Completion::CONTINUE || !has_label) {
         if (stmt.type() == Completion::BREAK && has_label) {
           Runtime::TopContext().ExitIteration();
-          return Completion(Completion::NORMAL, V, u"");
+          return Completion(Completion::NORMAL, V, kEmptyLabel);
         }
         if (stmt.IsAbruptCompletion()) {
           Runtime::TopContext().ExitIteration();
@@ -470,10 +478,10 @@ Completion EvalForInStatement(AST* ast) {
     }
   }
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::NORMAL, V, u"");
+  return Completion(Completion::NORMAL, V, kEmptyLabel);
 error:
   Runtime::TopContext().ExitIteration();
-  return Completion(Completion::THROW, e, u"");
+  return Completion(Completion::THROW, e, kEmptyLabel);
 }
 
 Completion EvalContinueStatement(AST* ast) {
@@ -481,10 +489,10 @@ Completion EvalContinueStatement(AST* ast) {
   Handle<Error> e = Error::Ok();
   if (!Runtime::TopContext().InIteration()) {
     e = Error::SyntaxError(u"continue not in iteration");
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   }
   ContinueOrBreak* stmt = static_cast<ContinueOrBreak*>(ast);
-  return Completion(Completion::CONTINUE, Handle<JSValue>(), stmt->ident());
+  return Completion(Completion::CONTINUE, Handle<JSValue>(), stmt->target());
 }
 
 Completion EvalBreakStatement(AST* ast) {
@@ -492,10 +500,10 @@ Completion EvalBreakStatement(AST* ast) {
   Handle<Error> e = Error::Ok();
   if (!Runtime::TopContext().InIteration() && !Runtime::TopContext().InSwitch()) {
     e = Error::SyntaxError(u"break not in iteration or switch");
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   }
   ContinueOrBreak* stmt = static_cast<ContinueOrBreak*>(ast);
-  return Completion(Completion::BREAK, Handle<JSValue>(), stmt->ident());
+  return Completion(Completion::BREAK, Handle<JSValue>(), stmt->target());
 }
 
 Completion EvalReturnStatement(AST* ast) {
@@ -503,22 +511,21 @@ Completion EvalReturnStatement(AST* ast) {
   Handle<Error> e = Error::Ok();
   Return* return_stmt = static_cast<Return*>(ast);
   if (return_stmt->expr() == nullptr) {
-    return Completion(Completion::RETURN, Undefined::Instance(), u"");
+    return Completion(Completion::RETURN, Undefined::Instance(), kEmptyLabel);
   }
   Handle<JSValue> exp = EvalExpressionAndGetValue(e, return_stmt->expr());
   if (unlikely(!e.val()->IsOk())) {
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   }
-  return Completion(Completion::RETURN, exp, u"");
+  return Completion(Completion::RETURN, exp, kEmptyLabel);
 }
 
 Completion EvalLabelledStatement(AST* ast) {
   ASSERT(ast->type() == AST::AST_STMT_LABEL);
   LabelledStmt* label_stmt = static_cast<LabelledStmt*>(ast);
-  label_stmt->statement()->SetLabel(label_stmt->label());
   Completion R = EvalStatement(label_stmt->statement());
   if (R.type() == Completion::BREAK && R.target() == label_stmt->label()) {
-    return Completion(Completion::NORMAL, R.value(), u"");
+    return Completion(Completion::NORMAL, R.value(), kEmptyLabel);
   }
   return R;
 }
@@ -530,19 +537,16 @@ Completion EvalWithStatement(AST* ast) {
     return Completion(
       Completion::THROW,
       Error::SyntaxError(u"cannot have with statement in strict mode"),
-      u"");
+      kEmptyLabel);
   }
   Handle<Error> e = Error::Ok();
   WhileOrWith* with_stmt = static_cast<WhileOrWith*>(ast);
-  Handle<JSValue> ref = EvalExpression(e, with_stmt->expr());
+  Handle<JSValue> val = EvalExpressionAndGetValue(e, with_stmt->expr());
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
-  Handle<JSValue> val = GetValue(e, ref);
-  if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   Handle<JSObject> obj = ToObject(e, val);
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   // Prevent garbage collect old env.
   Handle<EnvironmentRecord> old_env = Runtime::TopLexicalEnv();
   Handle<EnvironmentRecord> new_env = NewObjectEnvironment(obj, old_env, true);
@@ -554,61 +558,58 @@ Completion EvalWithStatement(AST* ast) {
 
 Completion EvalCaseBlock(Switch* switch_stmt, Handle<JSValue> input) {
   Handle<Error> e = Error::Ok();
-  Handle<JSValue> V;
-  bool found = false;
-  for (auto C : switch_stmt->before_default_case_clauses()) {
-    if (!found) {  // 5.a
+  const std::vector<Switch::CaseClause>& A = switch_stmt->before_default_case_clauses();
+  const std::vector<Switch::CaseClause>& B = switch_stmt->after_default_case_clauses();
+  size_t num_clauses = switch_stmt->num_case_clauses();
+  // The index of the first clause to run in A and then B, num_clauses if
+  // none matches.
+  size_t found;
+  Switch::JumpTable* table = switch_stmt->jump_table();
+  if (table != nullptr) {
+    found = table->Find(input.val(), num_clauses);
+  } else {
+    for (found = 0; found < num_clauses; ++found) {  // 5.a and 7.a
       // EvalCaseClause
-      Handle<JSValue> clause_selector = EvalExpressionAndGetValue(e, C.expr);
+      Handle<JSValue> clause_selector = EvalExpressionAndGetValue(e, switch_stmt->case_clause(found).expr);
+      if (unlikely(!e.val()->IsOk()))
+        return Completion(Completion::THROW, e, kEmptyLabel);
       bool b = StrictEqual(e, input, clause_selector);
       if (unlikely(!e.val()->IsOk()))
-        return Completion(Completion::THROW, e, u"");
+        return Completion(Completion::THROW, e, kEmptyLabel);
       if (b)
-        found = true;
+        break;
     }
-    if (found) {  // 5.b
-      Completion R = EvalStatementList(C.stmts);
+  }
+  Handle<JSValue> V;
+  // A clause found in B runs to the end of B, otherwise the rest of A, the
+  // default clause and then the whole B are run.
+  size_t b_start = 0;
+  if (found >= A.size() && found < num_clauses) {
+    b_start = found - A.size();
+  } else {
+    for (size_t i = found; i < A.size(); ++i) {  // 5.b
+      Completion R = EvalStatementList(A[i].stmts);
       if (!R.IsEmpty())
         V = R.value();
       if (R.IsAbruptCompletion())
         return Completion(R.type(), V, R.target());
     }
-  }
-  bool found_in_b = false;
-  size_t i;
-  for (i = 0; !found_in_b && i < switch_stmt->after_default_case_clauses().size(); i++) {
-    auto C = switch_stmt->after_default_case_clauses()[i];
-    // EvalCaseClause
-    Handle<JSValue> clause_selector = EvalExpressionAndGetValue(e, C.expr);
-    bool b = StrictEqual(e, input, clause_selector);
-    if (unlikely(!e.val()->IsOk()))
-      return Completion(Completion::THROW, e, u"");
-    if (b) {
-      found_in_b = true;
-      Completion R = EvalStatementList(C.stmts);
+    if (switch_stmt->has_default_clause()) {  // 8
+      Completion R = EvalStatementList(switch_stmt->default_clause().stmts);
       if (!R.IsEmpty())
         V = R.value();
       if (R.IsAbruptCompletion())
         return Completion(R.type(), V, R.target());
     }
   }
-  if (!found_in_b && switch_stmt->has_default_clause()) {  // 8
-    Completion R = EvalStatementList(switch_stmt->default_clause().stmts);
+  for (size_t i = b_start; i < B.size(); ++i) {  // 7.a.i and 9
+    Completion R = EvalStatementList(B[i].stmts);
     if (!R.IsEmpty())
       V = R.value();
     if (R.IsAbruptCompletion())
       return Completion(R.type(), V, R.target());
   }
-  for (; i < switch_stmt->after_default_case_clauses().size(); i++) {
-    auto C = switch_stmt->after_default_case_clauses()[i];
-    EvalExpressionAndGetValue(e, C.expr);
-    Completion R = EvalStatementList(C.stmts);
-    if (!R.IsEmpty())
-      V = R.value();
-    if (R.IsAbruptCompletion())
-      return Completion(R.type(), V, R.target());
-  }
-  return Completion(Completion::NORMAL, V, u"");
+  return Completion(Completion::NORMAL, V, kEmptyLabel);
 }
 
 // 12.11 The switch Statement
@@ -618,7 +619,7 @@ Completion EvalSwitchStatement(AST* ast) {
   Switch* switch_stmt = static_cast<Switch*>(ast);
   Handle<JSValue> expr_val = EvalExpressionAndGetValue(e, switch_stmt->expr());
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   Runtime::TopContext().EnterSwitch();
   Completion R = EvalCaseBlock(switch_stmt, expr_val);
   Runtime::TopContext().ExitSwitch();
@@ -626,7 +627,7 @@ Completion EvalSwitchStatement(AST* ast) {
     return R;
   bool has_label = ast->label() == R.target();
   if (R.type() == Completion::BREAK && has_label)
-    return Completion(Completion::NORMAL, R.value(), u"");
+    return Completion(Completion::NORMAL, R.value(), kEmptyLabel);
   return R;
 }
 
@@ -635,13 +636,10 @@ Completion EvalThrowStatement(AST* ast) {
   ASSERT(ast->type() == AST::AST_STMT_THROW);
   Handle<Error> e = Error::Ok();
   Throw* throw_stmt = static_cast<Throw*>(ast);
-  Handle<JSValue> exp_ref = EvalExpression(e, throw_stmt->expr());
-  if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
-  Handle<JSValue> val = GetValue(e, exp_ref);
+  Handle<JSValue> val = EvalExpressionAndGetValue(e, throw_stmt->expr());
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
-  return Completion(Completion::THROW, val, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
+  return Completion(Completion::THROW, val, kEmptyLabel);
 }
 
 Completion EvalCatch(Try* try_stmt, Completion C) {
@@ -665,7 +663,7 @@ Completion EvalCatch(Try* try_stmt, Completion C) {
   CreateAndSetMutableBinding(
     e, catch_env, try_stmt->catch_ident(), false, val, false);  // 4 & 5
   if (unlikely(!e.val()->IsOk())) {
-    return Completion(Completion::THROW, e, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
   }
   Runtime::TopContext().SetLexicalEnv(catch_env);
   Completion B = EvalBlockStatement(try_stmt->catch_block());
@@ -679,7 +677,7 @@ Completion EvalTryStatement(AST* ast) {
   if (Runtime::TopContext().strict()) {
     if (try_stmt->catch_ident_is_eval_or_arguments()) {
       Handle<Error> e = Error::SyntaxError(u"use eval or arguments as identifier of catch in strict mode");
-      return Completion(Completion::THROW, e, u"");
+      return Completion(Completion::THROW, e, kEmptyLabel);
     }
   }
   Completion B = EvalBlockStatement(try_stmt->try_block());
@@ -708,16 +706,20 @@ Completion EvalExpressionStatement(AST* ast) {
   Handle<Error> e = Error::Ok();
   Handle<JSValue> val = EvalExpressionAndGetValue(e, ast);
   if (unlikely(!e.val()->IsOk()))
-    return Completion(Completion::THROW, e, u"");
-  return Completion(Completion::NORMAL, val, u"");
+    return Completion(Completion::THROW, e, kEmptyLabel);
+  return Completion(Completion::NORMAL, val, kEmptyLabel);
 }
 
+// The value is only read, so no Reference is created for the identifiers
+// and the property accesses.
 Handle<JSValue> EvalExpressionAndGetValue(Handle<Error>& e, AST* ast) {
-  while (ast->type() == AST::AST_EXPR_LHS) {
-    LHS* lhs = static_cast<LHS*>(ast);
-    if (lhs->total_count() != 0)
+  while (true) {
+    if (ast->type() == AST::AST_EXPR_LHS && static_cast<LHS*>(ast)->total_count() == 0)
+      ast = static_cast<LHS*>(ast)->base();
+    else if (ast->type() == AST::AST_EXPR_PAREN)
+      ast = static_cast<Paren*>(ast)->expr();
+    else
       break;
-    ast = lhs->base();
   }
   switch (ast->type()) {
     case AST::AST_EXPR_STRICT_FUTURE:
@@ -729,6 +731,9 @@ Handle<JSValue> EvalExpressionAndGetValue(Handle<Error>& e, AST* ast) {
     case AST::AST_EXPR_IDENT: {
       return EvalIdentifierAndGetValue(e, ast);
     }
+    case AST::AST_EXPR_LHS: {
+      return EvalLeftHandSideExpressionAndGetValue(e, ast);
+    }
     default: {
       Handle<JSValue> ref = EvalExpression(e, ast);
       if (unlikely(!e.val()->IsOk()))
@@ -877,13 +882,41 @@ Handle<Reference> EvalIdentifier(AST* ast) {
   return GetIdentifierReference(env, ref_name, strict);
 }
 
-Handle<JSValue> EvalIdentifierAndGetValue(Handle<Error>& e, AST* ast) {
+// Return where the value of the global binding of `ident` is, or nullptr
+// if it is not an own data property of the global object.
+JSValue** GlobalCell(Identifier* ident) {
+  JSValue** cell = ident->cell(GlobalCells::epoch);
+  if (cell != nullptr)
+    return cell;
+  HashMapV2::Entry* p = GlobalObject::Instance().val()->named_properties()->GetEntry(ident->jsval());
+  if (p == nullptr || p->val->IsAccessorPair())
+    return nullptr;
+  ident->SetCell(&p->val, p->has_writable && p->writable, GlobalCells::epoch);
+  return &p->val;
+}
+
+// When `this_value` is not nullptr, it is set to the this value of a call
+// on the identifier (11.2.3 step 6.b). It is left as is for the global
+// environment, which does not provide this.
+Handle<JSValue> EvalIdentifierAndGetValue(Handle<Error>& e, AST* ast, Handle<JSValue>* this_value) {
   ASSERT(ast->type() == AST::AST_EXPR_IDENT || ast->type() == AST::AST_EXPR_STRICT_FUTURE);
   ASSERT(!ast->jsval().IsNullptr());
   // 10.3.1 Identifier Resolution
   Handle<EnvironmentRecord> env = Runtime::TopLexicalEnv();
   Handle<String> ref_name = ast->jsval();
   bool strict = Runtime::TopContext().strict();
+  while (!env.val()->outer().IsNullptr()) {
+    if (HasBinding(env, ref_name)) {
+      if (this_value != nullptr)
+        *this_value = ImplicitThisValue(env);
+      return GetValueEnvRec(e, env, ref_name, strict);
+    }
+    env = env.val()->outer();
+  }
+  ASSERT(env.val() == EnvironmentRecord::Global().val());
+  JSValue** cell = GlobalCell(static_cast<Identifier*>(ast));
+  if (cell != nullptr)
+    return Handle<JSValue>(*cell);
   return GetIdentifierReferenceAndGetValue(e, env, ref_name, strict);
 }
 
@@ -894,6 +927,18 @@ void EvalIdentifierAndPutValue(Handle<Error>& e, AST* ast, Handle<JSValue> val)
   Handle<EnvironmentRecord> env = Runtime::TopLexicalEnv();
   Handle<String> ref_name = ast->jsval();
   bool strict = Runtime::TopContext().strict();
+  while (!env.val()->outer().IsNullptr()) {
+    if (HasBinding(env, ref_name))
+      return PutValueEnvRec(e, env, ref_name, strict, val);
+    env = env.val()->outer();
+  }
+  ASSERT(env.val() == EnvironmentRecord::Global().val());
+  Identifier* ident = static_cast<Identifier*>(ast);
+  JSValue** cell = GlobalCell(ident);
+  if (cell != nullptr && ident->writable()) {
+    *cell = val.val();
+    return;
+  }
   return GetIdentifierReferenceAndPutValue(e, env, ref_name, strict, val);
 }
 
@@ -916,19 +961,97 @@ Handle<String> EvalString(Handle<Error>& e, AST* ast) {
   return s;
 }
 
+// The value of a literal that is the same constant on every evaluation,
+// nullptr for the other expressions.
+JSValue* ConstantLiteralValue(AST* ast) {
+  switch (ast->type()) {
+    case AST::AST_EXPR_NULL:
+      return Null::Instance().val();
+    case AST::AST_EXPR_BOOL:
+    case AST::AST_EXPR_NUMBER:
+      return ast->jsval().val();
+    case AST::AST_EXPR_STRING:
+      return ast->jsval().val()->IsError() ? nullptr : ast->jsval().val();
+    default:
+      return nullptr;
+  }
+}
+
+// The named properties of a fresh object of `obj_ast`, with the constant
+// values filled in and the others undefined. Like the BindingTemplate, it
+// is a constant hashmap, in which the i-th entry is the i-th property.
+// nullptr when the literal is empty or has accessors or repeated names,
+// which need the checks of 11.1.5.
+HashMapV2* ObjectBoilerplate(ObjectLiteral* obj_ast) {
+  if (obj_ast->has_boilerplate())
+    return obj_ast->boilerplate();
+  const auto& properties = obj_ast->properties();
+  std::unordered_set<String*, StringHasher, StringEqualer> names;
+  bool simple = properties.size() > 0;
+  for (auto property : properties) {
+    simple = simple && property.type == ObjectLiteral::Property::NORMAL &&
+             !property.key.val()->IsError() && names.insert(property.key.val()).second;
+  }
+  if (!simple) {
+    obj_ast->SetBoilerplate(nullptr);
+    return nullptr;
+  }
+  Handle<HashMapV2> boilerplate = HashMapV2::New<4, GCFlag::CONST>(properties.size());
+  // The constant space is not 0ed.
+  boilerplate.val()->Clear();
+  auto entry_fn = [](HashMapV2::Entry* p) {
+    SetAttributes(p, StackPropertyDescriptor::NewDataDescriptor(Undefined::Instance(), true, true, true));
+  };
+  for (auto property : properties) {
+    JSValue* val = ConstantLiteralValue(property.value);
+    boilerplate = HashMapV2::Set(
+      boilerplate, property.key, Handle<JSValue>(val != nullptr ? val : Undefined::Instance().val()), entry_fn);
+  }
+  obj_ast->SetBoilerplate(boilerplate.val());
+  return boilerplate.val();
+}
+
+// The element slots of a fresh array of `array_ast`, with the constant
+// values filled in and the others undefined. The holes are empty slots.
+const std::vector<PropertyMap::Slot>& ArrayBoilerplate(ArrayLiteral* array_ast) {
+  if (!array_ast->has_boilerplate()) {
+    std::vector<PropertyMap::Slot> boilerplate(array_ast->length());
+    for (auto pair : array_ast->elements()) {
+      JSValue* val = ConstantLiteralValue(pair.second);
+      PropertyMap::Slot* p = &boilerplate[pair.first];
+      p->val = val != nullptr ? val : Undefined::Instance().val();
+      SetAttributes(p, StackPropertyDescriptor::NewDataDescriptor(Undefined::Instance(), true, true, true));
+    }
+    array_ast->SetBoilerplate(std::move(boilerplate));
+  }
+  return array_ast->boilerplate();
+}
+
 Handle<Object> EvalObject(Handle<Error>& e, AST* ast) {
   ASSERT(ast->type() == AST::AST_EXPR_OBJ);
   ObjectLiteral* obj_ast = static_cast<ObjectLiteral*>(ast);
-  bool strict = Runtime::TopContext().strict();
   Handle<Object> obj = Object::New(obj_ast->properties().size());
+  HashMapV2* boilerplate = ObjectBoilerplate(obj_ast);
+  if (boilerplate != nullptr) {
+    PropertyMap::CopyFrom(obj, boilerplate);
+    const auto& properties = obj_ast->properties();
+    for (size_t i = 0; i < properties.size(); ++i) {
+      if (ConstantLiteralValue(properties[i].value) != nullptr)
+        continue;
+      Handle<JSValue> prop_value = EvalExpressionAndGetValue(e, properties[i].value);
+      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+      // The hashmap may be moved by the evaluation.
+      obj.val()->named_properties()->hashmap()->map_start()[i].val = prop_value.val();
+    }
+    return obj;
+  }
+  bool strict = Runtime::TopContext().strict();
   // PropertyName : AssignmentExpression
   for (auto property : obj_ast->properties()) {
     StackPropertyDescriptor desc;
     switch (property.type) {
       case ObjectLiteral::Property::NORMAL: {
-        Handle<JSValue> expr_value = EvalExpression(e, property.value);
-        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-        Handle<JSValue> prop_value = GetValue(e, expr_value);
+        Handle<JSValue> prop_value = EvalExpressionAndGetValue(e, property.value);
         if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         desc = StackPropertyDescriptor::NewDataDescriptor(prop_value, true, true, true);
         break;
@@ -966,18 +1089,18 @@ Handle<Object> EvalObject(Handle<Error>& e, AST* ast) {
     if (!previous_desc.IsUndefined()) {  // 4
       if (strict &&
           previous_desc.IsDataDescriptor() && desc.IsDataDescriptor()) {  // 4.a
-        e = Error::SyntaxError(u"repeat object property name " + prop_name_str.val()->data());
+        e = Error::SyntaxError(u"repeat object property name ", prop_name_str);
         return Handle<JSValue>();
       }
       if ((previous_desc.IsDataDescriptor() && desc.IsAccessorDescriptor()) ||  // 4.b
           (previous_desc.IsAccessorDescriptor() && desc.IsDataDescriptor())) {  // 4.c
-        e = Error::SyntaxError(u"repeat object property name " + prop_name_str.val()->data());
+        e = Error::SyntaxError(u"repeat object property name ", prop_name_str);
         return Handle<JSValue>();
       }
       if (previous_desc.IsAccessorDescriptor() && desc.IsAccessorDescriptor() &&  // 4.d
           ((previous_desc.HasGet() && desc.HasGet()) ||
            (previous_desc.HasSet() && desc.HasSet()))) {
-        e = Error::SyntaxError(u"repeat object property name " + prop_name_str.val()->data());
+        e = Error::SyntaxError(u"repeat object property name ", prop_name_str);
         return Handle<JSValue>();
       }
     }
@@ -991,12 +1114,17 @@ Handle<ArrayObject> EvalArray(Handle<Error>& e, AST* ast) {
   ArrayLiteral* array_ast = static_cast<ArrayLiteral*>(ast);
 
   Handle<ArrayObject> arr = ArrayObject::New(array_ast->length());
+  const std::vector<PropertyMap::Slot>& boilerplate = ArrayBoilerplate(array_ast);
+  if (boilerplate.size() > 0) {
+    memcpy(arr.val()->named_properties()->GetSlot(0), boilerplate.data(),
+           boilerplate.size() * sizeof(PropertyMap::Slot));
+  }
   for (auto pair : array_ast->elements()) {
-    Handle<JSValue> init_result = EvalExpression(e, pair.second);
-    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    Handle<JSValue> init_value = GetValue(e, init_result);
+    if (ConstantLiteralValue(pair.second) != nullptr)
+      continue;
+    Handle<JSValue> init_value = EvalExpressionAndGetValue(e, pair.second);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    AddValueProperty(arr, NumberToString(pair.first), init_value, true, true, true);
+    arr.val()->named_properties()->GetSlot(pair.first)->val = init_value.val();
   }
   return arr;
 }
@@ -1004,10 +1132,15 @@ Handle<ArrayObject> EvalArray(Handle<Error>& e, AST* ast) {
 Handle<JSValue> EvalUnaryOperator(Handle<Error>& e, AST* ast) {
   ASSERT(ast->type() == AST::AST_EXPR_UNARY);
   Unary* u = static_cast<Unary*>(ast);
+  Token op = u->op();
 
-  Handle<JSValue> expr = EvalExpression(e, u->node());
+  // Only these operators need the Reference.
+  bool use_reference =
+    op.type() == Token::TK_INC || op.type() == Token::TK_DEC ||
+    op.type() == Token::TK_KEYWORD_DELETE || op.type() == Token::TK_KEYWORD_TYPEOF;
+  Handle<JSValue> expr = use_reference ?
+    EvalExpression(e, u->node()) : EvalExpressionAndGetValue(e, u->node());
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-  Token op = u->op();
 
   switch (op.type()) {
     case Token::TK_INC:    // ++
@@ -1083,7 +1216,7 @@ Handle<JSValue> EvalUnaryOperator(Handle<Error>& e, AST* ast) {
       bool is_strict_ref = Runtime::TopContext().strict();
       if (Reference::IsUnresolvableReference(base)) {  // 3
         if (is_strict_ref) {
-          e = Error::SyntaxError(u"delete not exist variable " + ref_name.val()->data());
+          e = Error::SyntaxError(u"delete not exist variable ", ref_name);
           return Bool::False();
         }
         return Bool::True();
@@ -1405,7 +1538,7 @@ Handle<JSValue> EvalSimpleAssignment(Handle<Error>& e, Handle<JSValue> lref, Han
       Handle<JSValue> base = stack_ref.base;
       Handle<String> ref_name = stack_ref.name;
       if (Reference::IsUnresolvableReference(base)) {
-        e = Error::ReferenceError(ref_name.val()->data() + u" is not defined");
+        e = Error::ReferenceError(u"", ref_name, u" is not defined");
         return Handle<JSValue>();
       }
       if (base.val()->IsEnvironmentRecord() &&
@@ -1429,13 +1562,9 @@ Handle<JSValue> EvalTripleConditionExpression(Handle<Error>& e, AST* ast) {
   Handle<JSValue> lval = EvalExpressionAndGetValue(e, t->cond());
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   if (ToBoolean(lval)) {
-    Handle<JSValue> true_ref = EvalExpression(e, t->true_expr());
-    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    return GetValue(e, true_ref);
+    return EvalExpressionAndGetValue(e, t->true_expr());
   } else {
-    Handle<JSValue> false_ref = EvalExpression(e, t->false_expr());
-    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    return GetValue(e, false_ref);
+    return EvalExpressionAndGetValue(e, t->false_expr());
   }
 }
 
@@ -1443,7 +1572,6 @@ Handle<JSValue> EvalLeftHandSideExpression(Handle<Error>& e, AST* ast) {
   ASSERT(ast->type() == AST::AST_EXPR_LHS);
   LHS* lhs = static_cast<LHS*>(ast);
 
-  ValueGuard guard;
   Handle<JSValue> base = EvalExpression(e, lhs->base());
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
 
@@ -1451,35 +1579,38 @@ Handle<JSValue> EvalLeftHandSideExpression(Handle<Error>& e, AST* ast) {
   for (auto pair : lhs->order()) {
     switch (pair.second) {
       case LHS::PostfixType::CALL: {
+        // 11.2.2 and 11.2.3, the callee is got before the arguments are
+        // evaluated.
+        Handle<JSValue> func = GetValue(e, base);
+        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         Arguments* args = lhs->args_list()[pair.first];
-        std::vector<Handle<JSValue>> arg_list = EvalArgumentsList(e, args);
+        ArgumentWindow arg_list;
+        EvalArgumentsList(e, args, arg_list);
         if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         if (new_count > 0) {
-          base = GetValue(e, base);
-          if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-          if (!base.val()->IsConstructor()) {
+          if (!func.val()->IsConstructor()) {
             e = Error::TypeError(u"base value is not a constructor");
             return Handle<JSValue>();
           }
-          Handle<JSObject> constructor = static_cast<Handle<JSObject>>(base);
-          base = Construct(e, constructor, std::move(arg_list));
+          Handle<JSObject> constructor = static_cast<Handle<JSObject>>(func);
+          base = Construct(e, constructor, arg_list.span());
           if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
           new_count--;
         } else {
-          base = EvalCallExpression(e, base, std::move(arg_list));
+          base = EvalCallExpression(e, base, func, arg_list.span());
           if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         }
         break;
       }
       case LHS::PostfixType::INDEX: {
         auto index = lhs->index_list()[pair.first];
-        base = EvalIndexExpression(e, base, index, guard);
+        base = EvalIndexExpression(e, base, index);
         if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         break;
       }
       case LHS::PostfixType::PROP: {
         auto prop = lhs->prop_name_list()[pair.first];
-        base = EvalIndexExpression(e, base, prop, guard);
+        base = EvalIndexExpression(e, base, prop);
         if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
         break;
       }
@@ -1502,37 +1633,129 @@ Handle<JSValue> EvalLeftHandSideExpression(Handle<Error>& e, AST* ast) {
   return base;
 }
 
-std::vector<Handle<JSValue>> EvalArgumentsList(Handle<Error>& e, Arguments* ast) {
-  std::vector<Handle<JSValue>> arg_list;
+// A left hand side expression whose value is only read. A property access
+// is kept as the pair of base and name until the next postfix, so that it
+// is read directly or called with the base as this, instead of creating a
+// Reference.
+Handle<JSValue> EvalLeftHandSideExpressionAndGetValue(Handle<Error>& e, AST* ast) {
+  ASSERT(ast->type() == AST::AST_EXPR_LHS);
+  LHS* lhs = static_cast<LHS*>(ast);
+  if (lhs->new_count() > 0) {
+    Handle<JSValue> ref = EvalLeftHandSideExpression(e, ast);
+    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    return GetValue(e, ref);
+  }
+
+  const auto& order = lhs->order();
+  ASSERT(order.size() > 0);
+  AST* base_ast = lhs->base();
+  bool base_is_called = order[0].second == LHS::PostfixType::CALL;
+  bool call_identifier = base_is_called &&
+    (base_ast->type() == AST::AST_EXPR_IDENT || base_ast->type() == AST::AST_EXPR_STRICT_FUTURE);
+  Handle<JSValue> base;
+  Handle<JSValue> this_value = Undefined::Instance();
+  if (call_identifier) {
+    if (base_ast->type() == AST::AST_EXPR_STRICT_FUTURE && Runtime::TopContext().strict()) {
+      e = Error::SyntaxError(u"future reserved word " + base_ast->source() + u" used");
+      return Handle<JSValue>();
+    }
+    base = EvalIdentifierAndGetValue(e, base_ast, &this_value);
+  } else if (base_is_called) {
+    // Could be a Reference, e.g. (a.b)().
+    base = EvalExpression(e, base_ast);
+  } else {
+    base = EvalExpressionAndGetValue(e, base_ast);
+  }
+  if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+
+  // Not nullptr when base[name] is not read yet.
+  Handle<String> name;
+  for (size_t i = 0; i < order.size(); ++i) {
+    switch (order[i].second) {
+      case LHS::PostfixType::CALL: {
+        Arguments* args = lhs->args_list()[order[i].first];
+        Handle<String> ref_name;
+        bool is_reference = true;
+        if (!name.IsNullptr()) {
+          this_value = base;
+          base = GetValueProperty(e, base, name);
+          if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+          if (args->may_call_eval())
+            ref_name = name;
+          name = Handle<String>();
+        } else if (i == 0 && call_identifier) {
+          if (args->may_call_eval())
+            ref_name = base_ast->jsval();
+        } else {
+          is_reference = false;
+        }
+        // The base is still a Reference here, e.g. (a.b)().
+        Handle<JSValue> func = is_reference ? base : GetValue(e, base);
+        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        ArgumentWindow arg_list;
+        EvalArgumentsList(e, args, arg_list);
+        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        if (is_reference)
+          base = EvalCall(e, func, this_value, ref_name, arg_list.span());
+        else
+          base = EvalCallExpression(e, base, func, arg_list.span());
+        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        break;
+      }
+      case LHS::PostfixType::INDEX:
+      case LHS::PostfixType::PROP: {
+        if (!name.IsNullptr()) {
+          base = GetValueProperty(e, base, name);
+          if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        }
+        if (order[i].second == LHS::PostfixType::PROP) {
+          name = lhs->prop_name_list()[order[i].first];
+        } else {
+          Handle<JSValue> property_name_value = EvalExpressionAndGetValue(e, lhs->index_list()[order[i].first]);
+          if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+          name = ToString(e, property_name_value);
+          if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        }
+        if (unlikely(base.val()->IsUndefined() || base.val()->IsNull())) {
+          if (base.val()->IsUndefined()) {
+            e = Error::TypeError(u"cannot read property ", name, u" of undefined");
+          } else {
+            e = Error::TypeError(u"cannot read property ", name, u" of null");
+          }
+          return Handle<JSValue>();
+        }
+        break;
+      }
+      default:
+        assert(false);
+    }
+  }
+  if (!name.IsNullptr())
+    return GetValueProperty(e, base, name);
+  return base;
+}
+
+void EvalArgumentsList(Handle<Error>& e, Arguments* ast, ArgumentWindow& arg_list) {
   for (AST* arg_ast : ast->args()) {
     Handle<JSValue> arg = EvalExpressionAndGetValue(e, arg_ast);
     if (unlikely(!e.val()->IsOk()))
-      return {};
-    arg_list.emplace_back(arg);
+      return;
+    arg_list.Add(arg);
   }
-  return arg_list;
 }
 
-// 11.2.3
-Handle<JSValue> EvalCallExpression(Handle<Error>& e, Handle<JSValue> ref, std::vector<Handle<JSValue>> arg_list) {
-  Handle<JSValue> val = GetValue(e, ref);
-  if (unlikely(!e.val()->IsOk()))
-    return Handle<JSValue>();
-  if (unlikely(!val.val()->IsObject() && !val.val()->IsCallable())) {  // 4, 5
-    if (!val.val()->IsObject()) {
-      e = Error::TypeError(u"calling non-object.");
-      return Handle<JSValue>();
-    }
-    e = Error::TypeError(u"calling non-callable.");
-    return Handle<JSValue>();
-  }
-  auto obj = static_cast<Handle<JSObject>>(val);
-  Handle<JSValue> this_value;
+// 11.2.3, `func` is GetValue(ref), which is got before the arguments are
+// evaluated.
+Handle<JSValue> EvalCallExpression(
+  Handle<Error>& e, Handle<JSValue> ref, Handle<JSValue> func, Span<Handle<JSValue>> arg_list
+) {
+  Handle<JSValue> this_value = Undefined::Instance();
+  Handle<String> ref_name;
   if (ref.val()->IsReference()) {
     Handle<Reference> r = static_cast<Handle<Reference>>(ref);
     auto stack_ref = Runtime::TopContext().GetReference(r.val()->id());
     Handle<JSValue> base = stack_ref.base;
-    Handle<String> ref_name = stack_ref.name;
+    ref_name = stack_ref.name;
     if (Reference::IsPropertyReference(base)) {
       this_value = base;
     } else {
@@ -1540,28 +1763,52 @@ Handle<JSValue> EvalCallExpression(Handle<Error>& e, Handle<JSValue> ref, std::v
       auto env_rec = static_cast<Handle<EnvironmentRecord>>(base);
       this_value = ImplicitThisValue(env_rec);
     }
-    // indirect
-    if (unlikely(StringEqual(ref_name, String::eval()))) {
-      DirectEvalGuard guard;
-      return Call(e, obj, this_value, std::move(arg_list));
+  }
+  return EvalCall(e, func, this_value, ref_name, arg_list);
+}
+
+// 11.2.3 steps 4 to 8, `ref_name` is the name of the Reference called, or
+// nullptr if it is not a Reference.
+Handle<JSValue> EvalCall(
+  Handle<Error>& e, Handle<JSValue> func, Handle<JSValue> this_value, Handle<String> ref_name,
+  Span<Handle<JSValue>> arg_list
+) {
+  if (unlikely(!func.val()->IsObject() && !func.val()->IsCallable())) {  // 4, 5
+    if (!func.val()->IsObject()) {
+      e = Error::TypeError(u"calling non-object.");
+      return Handle<JSValue>();
     }
-  } else {
-    this_value = Undefined::Instance();
+    e = Error::TypeError(u"calling non-callable.");
+    return Handle<JSValue>();
+  }
+  auto obj = static_cast<Handle<JSObject>>(func);
+  // indirect
+  if (unlikely(!ref_name.IsNullptr() && StringEqual(ref_name, String::eval()))) {
+    DirectEvalGuard guard;
+    return Call(e, obj, this_value, arg_list);
+  }
+  // Most callees are script functions or builtins, enter them directly
+  // instead of going through the dispatch in Call.
+  switch (obj.val()->type()) {
+    case Type::OBJ_FUNC:
+      return Call__Function(e, static_cast<Handle<FunctionObject>>(obj), this_value, arg_list);
+    case Type::OBJ_INNER_FUNC:
+      return obj.val()->callable()(e, this_value, arg_list);
+    default:
+      return Call(e, obj, this_value, arg_list);
   }
-  return Call(e, obj, this_value, std::move(arg_list));
 }
 
 // 11.2.1 Property Accessors
-Handle<Reference> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, Handle<String> identifier_name, ValueGuard& guard) {
+Handle<Reference> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, Handle<String> identifier_name) {
   Handle<JSValue> base_value = GetValue(e, base_ref);
   if (unlikely(!e.val()->IsOk()))
     return Handle<JSValue>();
-  guard.AddValue(base_value);
   if (unlikely(base_value.val()->IsUndefined() || base_value.val()->IsNull())) {
     if (base_value.val()->IsUndefined()) {
-      e = Error::TypeError(u"cannot read property " + identifier_name.val()->data() + u" of undefined");
+      e = Error::TypeError(u"cannot read property ", identifier_name, u" of undefined");
     } else {
-      e = Error::TypeError(u"cannot read property " + identifier_name.val()->data() + u" of null");
+      e = Error::TypeError(u"cannot read property ", identifier_name, u" of null");
     }
     return Handle<Reference>();
   }
@@ -1570,14 +1817,14 @@ Handle<Reference> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref
   return Runtime::TopContext().AddReference(base_value, identifier_name);
 }
 
-Handle<JSValue> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, AST* expr, ValueGuard& guard) {
+Handle<JSValue> EvalIndexExpression(Handle<Error>& e, Handle<JSValue> base_ref, AST* expr) {
   Handle<JSValue> property_name_value = EvalExpressionAndGetValue(e, expr);
   if (unlikely(!e.val()->IsOk()))
     return Handle<JSValue>();
   Handle<String> property_name_str = ToString(e, property_name_value);
   if (unlikely(!e.val()->IsOk()))
     return Handle<JSValue>();
-  return EvalIndexExpression(e, base_ref, property_name_str, guard);
+  return EvalIndexExpression(e, base_ref, property_name_str);
 }
 
 Handle<JSValue> EvalExpressionList(Handle<Error>& e, AST* ast) {
@@ -1586,9 +1833,7 @@ Handle<JSValue> EvalExpressionList(Handle<Error>& e, AST* ast) {
   ASSERT(exprs->elements().size() > 0);
   Handle<JSValue> val;
   for (AST* expr : exprs->elements()) {
-    Handle<JSValue> ref = EvalExpression(e, expr);
-    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    val = GetValue(e, ref);
+    val = EvalExpressionAndGetValue(e, expr);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   }
   return val;
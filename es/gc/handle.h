@@ -33,19 +33,7 @@ class HandleScope {
     assert(Flag(val) & GCFlag::CONST);
 #endif
     if ((Flag(val) & GCFlag::CONST)) {
-      if (constant_pointers_map_.size() == kNumConstantHandle) {
-        throw std::runtime_error("too much constant handles");
-      }
-      auto iter = constant_pointers_map_.find(val);
-      if (iter != constant_pointers_map_.end()) {
-        size_t offset = iter->second;
-        return constant_pointers_ + offset;
-      }
-      size_t offset = constant_pointers_map_.size();
-      HeapObject** ptr = constant_pointers_ + offset;
-      *ptr = val;
-      constant_pointers_map_[val] = offset;
-      return ptr;
+      return AddConstant(val);
     } else if ((Flag(val) & GCFlag::SINGLE)) {
       if (singleton_pointers_count_ == kNumSingletonHandle) {
         throw std::runtime_error("too much singleton handles");
@@ -64,6 +52,26 @@ normal:
     return block_stack_.Add(val);
   }
 
+  // The slot of a constant object or a value on stack, which is never
+  // released. The values on stack held by the AST are put here, as the AST
+  // may outlive the scope it is parsed in, e.g. the code of eval.
+  static HeapObject** AddConstant(HeapObject* val) {
+    ASSERT((reinterpret_cast<uint64_t>(val) & STACK_MASK) || (Flag(val) & GCFlag::CONST));
+    if (constant_pointers_map_.size() == kNumConstantHandle) {
+      throw std::runtime_error("too much constant handles");
+    }
+    auto iter = constant_pointers_map_.find(val);
+    if (iter != constant_pointers_map_.end()) {
+      size_t offset = iter->second;
+      return constant_pointers_ + offset;
+    }
+    size_t offset = constant_pointers_map_.size();
+    HeapObject** ptr = constant_pointers_ + offset;
+    *ptr = val;
+    constant_pointers_map_[val] = offset;
+    return ptr;
+  }
+
   static std::vector<HeapObject**> AllPointers() {
     size_t num_pointers = singleton_pointers_count_;
     if (likely(block_stack_.size() > 0)) {
@@ -134,6 +142,13 @@ class Handle {
 
   explicit Handle() : ptr_(nullptr) {}
 
+  // See HandleScope::AddConstant.
+  static Handle<T> Constant(T* value) {
+    Handle<T> handle;
+    handle.ptr_ = reinterpret_cast<T**>(HandleScope::AddConstant(reinterpret_cast<HeapObject*>(value)));
+    return handle;
+  }
+
   template<typename S>
   Handle(Handle<S> base) {
 #ifdef GC_DEBUG
@@ -41,31 +41,27 @@ class HeapObject {
 };
 
 class HashMapV2;
+class String;
 class DeclarativeEnvironmentRecord;
 class ProgramOrFunctionBody;
 struct ExtracGC {
   // save the resized hashmap
   static std::unordered_map<uint32_t, std::stack<HashMapV2*>> resize_released_maps;
 
-  struct FunctionDeclarativeEnvironmentRecord {
-    size_t id;
-    size_t call_count;
-    size_t stack_depth;
-    size_t num_pushed;
-    DeclarativeEnvironmentRecord** env_rec;
-
-    FunctionDeclarativeEnvironmentRecord(size_t id) :
-      call_count(0), stack_depth(0), num_pushed(0) {
-      env_rec = new DeclarativeEnvironmentRecord*[kMaxNumPushed];
-    }
-
-    DeclarativeEnvironmentRecord** operator[](size_t index) {
-      return env_rec + 8 * id + index;
-    }
-
+  // The released env records of a function, reused by the next calls of
+  // it. Each ProgramOrFunctionBody owns one, and those holding records are
+  // registered in `function_env_free_lists` so that gc could trace them.
+  // A record is only saved when its ref count is 0 as the call returns.
+  // The counts taken by closures and mapped arguments objects are never
+  // released, even after they are collected, so the calls that create
+  // them, and the calls of the enclosing functions, do not reuse records.
+  struct FunctionEnvRecFreeList {
     static constexpr size_t kMaxNumPushed = 8;
-    static constexpr size_t kMaxFunctionStored = 1024 * 1024;
-    static DeclarativeEnvironmentRecord* env_recs[kMaxNumPushed * kMaxFunctionStored];
+
+    size_t call_count = 0;
+    size_t num_pushed = 0;
+    bool registered = false;
+    DeclarativeEnvironmentRecord* env_recs[kMaxNumPushed];
   };
 
   static void TrySaveFunctionEnvRec(
@@ -76,15 +72,22 @@ struct ExtracGC {
     ProgramOrFunctionBody* body
   );
 
+  static void UnregisterFunctionEnvRecs(FunctionEnvRecFreeList* free_list);
+
   static std::vector<HeapObject**> Pointers();
 
-  static std::unordered_map<ProgramOrFunctionBody*, FunctionDeclarativeEnvironmentRecord>
-    function_env_recs;
+  // Recent results of NumberToString, cleared before each collection.
+  struct NumberStringCacheEntry {
+    double key;
+    String* val;
+  };
+  static constexpr size_t kNumberStringCacheSize = 1024;
+  static NumberStringCacheEntry number_string_cache[kNumberStringCacheSize];
+
+  static std::vector<FunctionEnvRecFreeList*> function_env_free_lists;
   static constexpr size_t kMinFunctionEnvRecSavingThreshold = 3;
 };
 
-DeclarativeEnvironmentRecord* ExtracGC::FunctionDeclarativeEnvironmentRecord::env_recs[kMaxNumPushed * kMaxFunctionStored];
-
 }  // namespace es
 
 #endif  // ES_GC_HEAP_OBJECT_H
\ No newline at end of file
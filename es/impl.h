@@ -11,6 +11,7 @@
 #include <es/impl/environment_record-impl.h>
 #include <es/impl/lexical_environment-impl.h>
 #include <es/impl/builtin/array_object_impl.h>
+#include <es/impl/builtin/function_object_impl.h>
 #include <es/impl/builtin/global_object_impl.h>
 #include <es/impl/builtin/object_object_impl.h>
 #include <es/impl/builtin/string_object_impl.h>
@@ -43,17 +43,9 @@ std::string JSValue::ToString(JSValue* jsval) {
       String* name = READ_VALUE(jsval, GetterSetter::kReferenceNameOffset, String*);
       return "GetterSetter(" + ToString(name) + ")";
     }
-    case JS_PROP_DESC: {
-      PropertyDescriptor* desc = static_cast<PropertyDescriptor*>(jsval);
-      std::string res = "PropertyDescriptor{";
-      if (desc->HasValue()) res += "v: " + desc->Value().ToString() + ", ";
-      if (desc->HasWritable()) res += "w: " + log::ToString(desc->Writable()) + ", ";
-      if (desc->HasGet()) res += "get: " + desc->Get().ToString() + ", ";
-      if (desc->HasSet()) res += "set: " + desc->Set().ToString() + ", ";
-      if (desc->HasEnumerable()) res += "e: " + log::ToString(desc->Enumerable()) + ", ";
-      if (desc->HasConfigurable()) res += "c: " + log::ToString(desc->Configurable());
-      res += '}';
-      return res;
+    case JS_ACCESSOR_PAIR: {
+      AccessorPair* pair = static_cast<AccessorPair*>(jsval);
+      return "AccessorPair(" + pair->Get().ToString() + "," + pair->Set().ToString() + ")";
     }
     case JS_ENV_REC_DECL:
       return "DeclarativeEnvRec(" + log::ToString(jsval) + "," +
@@ -73,10 +65,6 @@ std::string JSValue::ToString(JSValue* jsval) {
       return "HashMap(" + std::to_string(READ_VALUE(jsval, HashMapV2::kOccupancyOffset, size_t)) + ")";
     case HASHMAP:
       return "HashMap(" + std::to_string(READ_VALUE(jsval, HashMap::kSizeOffset, size_t)) + ")";
-    case PROPERTY_MAP: {
-      PropertyMap* map = static_cast<PropertyMap*>(jsval);
-      return "PropertyMap(" + std::to_string(map->num_fixed_slots()) + "," + map->hashmap().ToString() + ")";
-    }
     case LIST_NODE:
       return "ListNode(" + ToString(READ_VALUE(jsval, ListNode::kKeyOffset, String*)) + ")";
     case OBJ_ARRAY: {
@@ -225,63 +213,7 @@ Handle<Number> Number::Eval(const std::u16string& source) {
 #ifdef PARSER_TEST
   std::cout << "Number::Eval [" << log::ToString(source) << "]" << std::endl;
 #endif
-  double val = 0;
-  double frac = 1;
-  size_t pos = 0;
-  bool dot = false;
-  while (pos < source.size()) {
-    char16_t c = source[pos];
-    switch (c) {
-      case u'.':
-        dot = true;
-        break;
-      case u'e':
-      case u'E': {
-        double exp = 0;
-        bool sign = true;
-        pos++;  // skip e/E
-        c = source[pos];
-        if (c == u'-') {
-          sign = false;
-          pos++;  // skip -
-        } else if (c == u'+') {
-          sign = true;
-          pos++; // skip +;
-        }
-        while (pos < source.size()) {
-          c = source[pos];
-          exp *= 10;
-          exp += character::Digit(c);
-          pos++;
-        }
-        if (!sign)
-          exp = -exp;
-        return Number::New<flag>(val * pow(10.0, exp));
-      }
-      case u'x':
-      case u'X': {
-        ASSERT(val == 0);
-        pos++;
-        while (pos < source.size()) {
-          c = source[pos];
-          val *= 16;
-          val += character::Digit(c);
-          pos++;
-        }
-        return Number::New<flag>(val);
-      }
-      default:
-        if (dot) {
-          frac /= 10;
-          val += character::Digit(c) * frac;
-        } else {
-          val *= 10;
-          val += character::Digit(c);
-        }
-    }
-    pos++;
-  }
-  return Number::New<flag>(val);
+  return Number::New<flag>(CharsToDouble(source.data(), source.size()));
 }
 
 }  // namespace es
@@ -1,14 +1,16 @@
 #ifndef ES_IMPL_BASE_COLLECTION_IMPL_H
 #define ES_IMPL_BASE_COLLECTION_IMPL_H
 
+#include <algorithm>
+
 #include <es/gc/base_collection.h>
 #include <es/utils/hashmap_v2.h>
 
 namespace es {
 
 std::unordered_map<uint32_t, std::stack<HashMapV2*>> ExtracGC::resize_released_maps;
-std::unordered_map<ProgramOrFunctionBody*, ExtracGC::FunctionDeclarativeEnvironmentRecord>
-    ExtracGC::function_env_recs;
+std::vector<ExtracGC::FunctionEnvRecFreeList*> ExtracGC::function_env_free_lists;
+ExtracGC::NumberStringCacheEntry ExtracGC::number_string_cache[kNumberStringCacheSize];
 
 void ExtracGC::TrySaveFunctionEnvRec(
   ProgramOrFunctionBody* body, Handle<DeclarativeEnvironmentRecord> env_rec
@@ -19,61 +21,59 @@ void ExtracGC::TrySaveFunctionEnvRec(
     // env_rec is still referenced, maybe due to closure.
     return;
   }
-  auto iter = function_env_recs.find(body);
-  if (iter == function_env_recs.end()) {
-    size_t next_func_id = function_env_recs.size();
-    if (next_func_id >= FunctionDeclarativeEnvironmentRecord::kMaxFunctionStored) {
-      return;
-    }
-    function_env_recs.emplace(body, next_func_id);
-    iter = function_env_recs.find(body);
-  }
-  iter->second.stack_depth++;
-  if (iter->second.call_count < 10 * kMinFunctionEnvRecSavingThreshold) {
-    iter->second.call_count++;
+  FunctionEnvRecFreeList* free_list = body->env_recs();
+  if (free_list->call_count < 10 * kMinFunctionEnvRecSavingThreshold) {
+    free_list->call_count++;
   }
-  if (iter->second.call_count < kMinFunctionEnvRecSavingThreshold) {
+  if (free_list->call_count < kMinFunctionEnvRecSavingThreshold) {
     return;
   }
-  if (iter->second.num_pushed < FunctionDeclarativeEnvironmentRecord::kMaxNumPushed) {
+  if (free_list->num_pushed < FunctionEnvRecFreeList::kMaxNumPushed) {
     env_rec.val()->SetOuter(Handle<JSValue>());
     env_rec.val()->bindings()->Clear();
-    *iter->second[iter->second.num_pushed] = env_rec.val();
-    iter->second.num_pushed++;
+    free_list->env_recs[free_list->num_pushed++] = env_rec.val();
+    if (!free_list->registered) {
+      free_list->registered = true;
+      function_env_free_lists.emplace_back(free_list);
+    }
   }
 }
 
 Handle<DeclarativeEnvironmentRecord> ExtracGC::TryPopFunctionEnvRec(
   ProgramOrFunctionBody* body
 ) {
-  auto iter = function_env_recs.find(body);
-  if (iter == function_env_recs.end())
+  FunctionEnvRecFreeList* free_list = body->env_recs();
+  if (free_list->num_pushed == 0)
     return Handle<DeclarativeEnvironmentRecord>();
-  ASSERT(iter->second.stack_depth > 0);
-  iter->second.stack_depth--;
-  if (iter->second.num_pushed > 0) {
 #ifdef GC_DEBUG
-    assert(iter->second.env_rec[0]->IsDeclarativeEnv());
+  assert(free_list->env_recs[0]->IsDeclarativeEnv());
 #endif
-    size_t indx = --iter->second.num_pushed;
-    Handle<DeclarativeEnvironmentRecord> env_rec(*(iter->second[indx]));
-    return env_rec;
-  }
-  return Handle<DeclarativeEnvironmentRecord>();
+  return Handle<DeclarativeEnvironmentRecord>(free_list->env_recs[--free_list->num_pushed]);
+}
+
+void ExtracGC::UnregisterFunctionEnvRecs(FunctionEnvRecFreeList* free_list) {
+  auto iter = std::find(function_env_free_lists.begin(), function_env_free_lists.end(), free_list);
+  ASSERT(iter != function_env_free_lists.end());
+  *iter = function_env_free_lists.back();
+  function_env_free_lists.pop_back();
+  free_list->registered = false;
+  free_list->call_count = 0;
+  free_list->num_pushed = 0;
 }
 
 std::vector<HeapObject**> ExtracGC::Pointers() {
   std::vector<HeapObject**> pointers;
-  for (auto iter = std::begin(function_env_recs); iter != std::end(function_env_recs);) {
-    // remove the no longer called functions.
-    if (iter->second.call_count < kMinFunctionEnvRecSavingThreshold || iter->second.num_pushed == 0) {
-      iter = function_env_recs.erase(iter);
+  for (size_t i = 0; i < function_env_free_lists.size();) {
+    FunctionEnvRecFreeList* free_list = function_env_free_lists[i];
+    // release the records of the no longer called functions.
+    if (free_list->call_count < kMinFunctionEnvRecSavingThreshold || free_list->num_pushed == 0) {
+      UnregisterFunctionEnvRecs(free_list);
     } else {
-      iter->second.call_count = 0;
-      for (size_t i = 0; i < iter->second.num_pushed; ++i) {
-        pointers.emplace_back(reinterpret_cast<HeapObject**>(iter->second[i]));
+      free_list->call_count = 0;
+      for (size_t j = 0; j < free_list->num_pushed; ++j) {
+        pointers.emplace_back(reinterpret_cast<HeapObject**>(free_list->env_recs + j));
       }
-      ++iter;
+      ++i;
     }
   }
   return pointers;
@@ -82,6 +82,9 @@ std::vector<HeapObject**> ExtracGC::Pointers() {
 template<typename T>
 void GC<T>::CleanUpBeforeCollect() {
   ExtracGC::resize_released_maps.clear();
+  memset(ExtracGC::number_string_cache, 0, sizeof(ExtracGC::number_string_cache));
+  PrototypeLookupCache::Clear();
+  GlobalCells::Invalidate();
 }
 
 }  // namespace
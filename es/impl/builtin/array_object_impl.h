@@ -7,8 +7,8 @@
 namespace es {
 
 // 15.4.4.2 Array.prototype.toString ( )
-Handle<JSValue> ArrayProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> array = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> array = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   Handle<JSValue> func = Get(e, array, String::New(u"join"));
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
@@ -16,15 +16,16 @@ Handle<JSValue> ArrayProto::toString(Handle<Error>& e, Handle<JSValue> this_arg,
     func = Get(e, ObjectProto::Instance(), String::toString());
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   }
-  return Call(e, static_cast<Handle<JSObject>>(func), this_arg, vals);
+  return Call(e, static_cast<Handle<JSObject>>(func), array, vals);
 }
 
 // 15.4.4.4 Array.prototype.concat ( [ item1 [ , item2 [ , … ] ] ] )
-Handle<JSValue> ArrayProto::concat(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  std::vector<Handle<JSValue>> items = {Runtime::TopValue()};
-  items.insert(items.end(), vals.begin(), vals.end());
+Handle<JSValue> ArrayProto::concat(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  ArgumentWindow items;
+  items.Add(this_arg);
+  items.Add(vals);
   size_t total_len = 0;
-  for (auto E : items) {
+  for (auto E : items.span()) {
     if (E.val()->IsArrayObject()) {
       Handle<ArrayObject> O = static_cast<Handle<ArrayObject>>(E);
       size_t len = ToNumber(e, Get(e, O, String::Length()));
@@ -35,7 +36,7 @@ Handle<JSValue> ArrayProto::concat(Handle<Error>& e, Handle<JSValue> this_arg, s
   }
   Handle<ArrayObject> A = ArrayObject::New(total_len);
   size_t n = 0;
-  for (auto E : items) {
+  for (auto E : items.span()) {
     if (E.val()->IsArrayObject()) {
       Handle<ArrayObject> O = static_cast<Handle<ArrayObject>>(E);
       size_t len = ToNumber(e, Get(e, O, String::Length()));
@@ -58,8 +59,8 @@ Handle<JSValue> ArrayProto::concat(Handle<Error>& e, Handle<JSValue> this_arg, s
 }
 
 // 15.4.4.5 Array.prototype.join (separator)
-Handle<JSValue> ArrayProto::join(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::join(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   Handle<Number> len_val = static_cast<Handle<Number>>(Get(e, O, String::Length()));
   size_t len = len_val.val()->data();
@@ -90,8 +91,8 @@ Handle<JSValue> ArrayProto::join(Handle<Error>& e, Handle<JSValue> this_arg, std
 }
 
 // 15.4.4.6 Array.prototype.pop ( )
-Handle<JSValue> ArrayProto::pop(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::pop(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, O, String::Length()));
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
@@ -113,8 +114,8 @@ Handle<JSValue> ArrayProto::pop(Handle<Error>& e, Handle<JSValue> this_arg, std:
 }
 
 // 15.4.4.7 Array.prototype.push ( [ item1 [ , item2 [ , … ] ] ] )
-Handle<JSValue> ArrayProto::push(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::push(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   double n = ToNumber(e, Get(e, O, String::Length()));
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
@@ -130,8 +131,8 @@ Handle<JSValue> ArrayProto::push(Handle<Error>& e, Handle<JSValue> this_arg, std
 }
 
 // 15.4.4.9 Array.prototype.shift ( )
-Handle<JSValue> ArrayProto::shift(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::shift(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, O, String::Length()));
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
@@ -166,8 +167,8 @@ Handle<JSValue> ArrayProto::shift(Handle<Error>& e, Handle<JSValue> this_arg, st
 }
 
 // 15.4.4.10 Array.prototype.slice (start, end)
-Handle<JSValue> ArrayProto::slice(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::slice(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   double len = ToNumber(e, Get(e, O, String::Length()));
   if (vals.size() == 0 || vals[0].val()->IsUndefined()) {
@@ -208,8 +209,8 @@ Handle<JSValue> ArrayProto::slice(Handle<Error>& e, Handle<JSValue> this_arg, st
 }
 
 // 15.4.4.11 Array.prototype.sort (comparefn)
-Handle<JSValue> ArrayProto::sort(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> obj = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::sort(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> obj = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, obj, String::Length()));
   // TODO(zhuzilin) Check the implementation dependecy cases would not cause error.
@@ -274,8 +275,8 @@ Handle<JSValue> ArrayProto::sort(Handle<Error>& e, Handle<JSValue> this_arg, std
 }
 
 // 15.4.4.18 Array.prototype.forEach ( callbackfn [ , thisArg ] )
-Handle<JSValue> ArrayProto::forEach(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::forEach(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, O, String::Length()));
   if (vals.size() == 0 || !vals[0].val()->IsCallable()) {  // 4
@@ -304,8 +305,8 @@ Handle<JSValue> ArrayProto::forEach(Handle<Error>& e, Handle<JSValue> this_arg,
 }
 
 // 15.4.4.19 Array.prototype.map ( callbackfn [ , thisArg ] )
-Handle<JSValue> ArrayProto::map(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::map(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, O, String::Length()));
   if (vals.size() == 0 || !vals[0].val()->IsCallable()) {  // 4
@@ -336,8 +337,8 @@ Handle<JSValue> ArrayProto::map(Handle<Error>& e, Handle<JSValue> this_arg, std:
 }
 
 // 15.4.4.20 Array.prototype.filter ( callbackfn [ , thisArg ] )
-Handle<JSValue> ArrayProto::filter(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSObject> O = ToObject(e, Runtime::TopValue());
+Handle<JSValue> ArrayProto::filter(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSObject> O = ToObject(e, this_arg);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t len = ToNumber(e, Get(e, O, String::Length()));
   if (vals.size() == 0 || !vals[0].val()->IsCallable()) {  // 4
@@ -0,0 +1,72 @@
+#ifndef ES_IMPL_BUILTIN_FUNCTION_OBJECT_IMPL_H
+#define ES_IMPL_BUILTIN_FUNCTION_OBJECT_IMPL_H
+
+#include <es/types.h>
+
+namespace es {
+
+// 15.3.4.3 Function.prototype.apply (thisArg, argArray)
+Handle<JSValue> FunctionProto::apply(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSValue> val = this_arg;
+  if (!val.val()->IsObject()) {
+    e = Error::TypeError(u"Function.prototype.apply called on non-object");
+    return Handle<JSValue>();
+  }
+  Handle<JSObject> func = static_cast<Handle<JSObject>>(val);
+  if (!func.val()->IsCallable()) {
+    e = Error::TypeError(u"Function.prototype.apply called on non-callable");
+    return Handle<JSValue>();
+  }
+  if (vals.size() == 0) {
+    return Call(e, func, Undefined::Instance(), {});
+  }
+  if (vals.size() < 2 || vals[1].val()->IsNull() || vals[1].val()->IsUndefined()) {  // 2
+    return Call(e, func, vals[0], {});
+  }
+  if (!vals[1].val()->IsObject()) {  // 3
+    e = Error::TypeError(u"Function.prototype.apply's argument is non-object");
+    return Handle<JSValue>();
+  }
+  Handle<JSObject> arg_array = static_cast<Handle<JSObject>>(vals[1]);
+  Handle<JSValue> len = Get(e, arg_array, String::Length());
+  if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+  size_t n = ToNumber(e, len);
+  // The elements of arrays and arguments objects are mostly data properties
+  // in their fixed slots, which are copied directly. Holes, accessors,
+  // mapped indices and the other array-likes go through [[Get]].
+  size_t num_own_slots = 0;
+  if (arg_array.val()->IsArrayObject() || arg_array.val()->IsArgumentsObject())
+    num_own_slots = std::min<size_t>(n, arg_array.val()->named_properties()->num_fixed_slots());
+  bool is_arguments = arg_array.val()->IsArgumentsObject();
+  ArgumentWindow arg_list;  // 6
+  size_t index = 0;  // 7
+  while (index < n) {  // 8
+    if (index < num_own_slots) {
+      JSValue* own = arg_array.val()->named_properties()->GetSlot(index)->val;
+      bool mapped = is_arguments && static_cast<ArgumentsObject*>(arg_array.val())->IsMapped(index);
+      if (own != nullptr && !own->IsAccessorPair() && !mapped) {
+        arg_list.Add(Handle<JSValue>(own));
+        index++;
+        continue;
+      }
+      if (mapped) {
+        // 10.6 [[Get]], a mapped index reads the parameter.
+        ArgumentsObject* arguments = static_cast<ArgumentsObject*>(arg_array.val());
+        Handle<JSValue> next_arg = GetBindingValue(e, arguments->env(), arguments->ParameterName(index), false);
+        if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+        arg_list.Add(next_arg);
+        index++;
+        continue;
+      }
+    }
+    Handle<JSValue> next_arg = Get(e, arg_array, ::es::NumberToString(index));
+    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    arg_list.Add(next_arg);
+    index++;
+  }
+  return Call(e, func, vals[0], arg_list.span());
+}
+
+}  // namespace es
+
+#endif  // ES_IMPL_BUILTIN_FUNCTION_OBJECT_IMPL_H
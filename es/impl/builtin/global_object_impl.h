@@ -1,24 +1,66 @@
 #ifndef ES_IMPL_BUILTIN_GLOBAL_OBJECT_IMPL_H
 #define ES_IMPL_BUILTIN_GLOBAL_OBJECT_IMPL_H
 
+#include <list>
+#include <string_view>
+#include <unordered_map>
+
 #include <es/types.h>
 #include <es/enter_code.h>
 
 namespace es {
 
+// The programs parsed by eval, keyed by the source, so that a string that
+// is evaluated again is not parsed again. The parse does not depend on the
+// caller, as whether the eval code is strict is decided in EnterEvalCode.
+// The least recently used program is evicted when the cache is full, but
+// it is not deleted, because the functions created by it may still point
+// into it.
+struct EvalCache {
+  static AST* Get(const std::u16string& source) {
+    auto iter = index.find(source);
+    if (iter == index.end())
+      return nullptr;
+    entries.splice(entries.begin(), entries, iter->second);
+    return iter->second->second;
+  }
+
+  static void Put(std::u16string&& source, AST* program) {
+    entries.emplace_front(std::move(source), program);
+    index.emplace(entries.front().first, entries.begin());
+    if (entries.size() > kCapacity) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+    }
+  }
+
+  static constexpr size_t kCapacity = 64;
+  // The most recently used first. The keys of the index are views of the
+  // sources in the list.
+  static std::list<std::pair<std::u16string, AST*>> entries;
+  static std::unordered_map<std::u16string_view, decltype(entries)::iterator> index;
+};
+
+std::list<std::pair<std::u16string, AST*>> EvalCache::entries;
+std::unordered_map<std::u16string_view, decltype(EvalCache::entries)::iterator> EvalCache::index;
+
 // 15.1.2.1 eval(X)
-Handle<JSValue> GlobalObject::eval(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+Handle<JSValue> GlobalObject::eval(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
   TEST_LOG("\033[2menter\033[0m GlobalObject::eval");
   if (vals.size() == 0)
     return Undefined::Instance();
   if (!vals[0].val()->IsString())
     return vals[0];
   std::u16string x = static_cast<Handle<String>>(vals[0]).val()->data();
-  Parser parser(x);
-  AST* program = parser.ParseProgram();
-  if (program->IsIllegal()) {
-    e = Error::SyntaxError(u"failed to parse eval (" + program->source() + u")");
-    return Handle<JSValue>();
+  AST* program = EvalCache::Get(x);
+  if (program == nullptr) {
+    Parser parser(x);
+    program = parser.ParseProgram();
+    if (program->IsIllegal()) {
+      e = Error::SyntaxError(u"failed to parse eval (" + program->source() + u")");
+      return Handle<JSValue>();
+    }
+    EvalCache::Put(std::move(x), program);
   }
   EnterEvalCode(e, program);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
@@ -45,7 +87,7 @@ Handle<JSValue> GlobalObject::eval(Handle<Error>& e, Handle<JSValue> this_arg, s
 }
 
 // 15.1.2.2 parseInt (string , radix)
-Handle<JSValue> GlobalObject::parseInt(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+Handle<JSValue> GlobalObject::parseInt(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
   // TODO(zhuzilin) use parseFloat at the moment. fix later
   if (vals.size() == 0 || vals[0].val()->IsUndefined()) {
     e = Error::TypeError(u"parseInt called with undefined string");
@@ -99,7 +141,7 @@ Handle<JSValue> GlobalObject::parseInt(Handle<Error>& e, Handle<JSValue> this_ar
 }
 
 // 15.1.2.3 parseFloat (string)
-Handle<JSValue> GlobalObject::parseFloat(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+Handle<JSValue> GlobalObject::parseFloat(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
   if (vals.size() == 0)
     return Number::NaN();
   std::u16string input_string = es::ToU16String(e, vals[0]);
@@ -125,7 +167,7 @@ Handle<JSValue> GlobalObject::parseFloat(Handle<Error>& e, Handle<JSValue> this_
 }
 
 // 15.1.2.4 isNaN (number)
-Handle<JSValue> GlobalObject::isNaN(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+Handle<JSValue> GlobalObject::isNaN(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
   if (vals.size() == 0)
     return Bool::True();
   double num = ToNumber(e, vals[0]);
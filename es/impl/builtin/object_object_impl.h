@@ -6,13 +6,13 @@
 
 namespace es {
 
-Handle<JSValue> ObjectConstructor::keys(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+Handle<JSValue> ObjectConstructor::keys(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
   if (vals.size() < 1 || !vals[0].val()->IsObject()) {
     e = Error::TypeError(u"Object.keys called on non-object");
     return Handle<JSValue>();
   }
   Handle<JSObject> O = static_cast<Handle<JSObject>>(vals[0]);
-  auto keys = O.val()->AllEnumerableKeys();
+  auto keys = O.val()->OwnEnumerableKeys();
   size_t n = keys.size();
   Handle<ArrayObject> arr_obj = ArrayObject::New(n);
   for (size_t index = 0; index < n; index++) {
@@ -22,6 +22,36 @@ Handle<JSValue> ObjectConstructor::keys(Handle<Error>& e, Handle<JSValue> this_a
   return arr_obj;
 }
 
+Handle<JSValue> ObjectConstructor::getOwnPropertyNames(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  if (vals.size() < 1 || !vals[0].val()->IsObject()) {  // 1
+    e = Error::TypeError(u"Object.getOwnPropertyNames called on non-object");
+    return Handle<JSValue>();
+  }
+  Handle<JSObject> O = static_cast<Handle<JSObject>>(vals[0]);
+  // The properties that are not created yet are listed as well.
+  if (O.val()->named_properties()->has_pending_properties()) {
+    if (O.val()->IsErrorObject())
+      ErrorObject::MaterializeProperties(static_cast<Handle<ErrorObject>>(O));
+    else
+      FunctionObject::MaterializeProperties(static_cast<Handle<FunctionObject>>(O));
+  }
+  std::vector<Handle<String>> names;
+  // 15.5.5.2, the characters of a String object are own properties.
+  if (O.val()->IsStringObject()) {
+    Handle<String> str = static_cast<Handle<String>>(O.val()->PrimitiveValue());
+    for (size_t i = 0; i < str.val()->size(); ++i)
+      names.emplace_back(NumberToString(i));
+  }
+  for (Handle<String> name : O.val()->named_properties()->Keys([](auto* p) { return true; }))
+    names.emplace_back(name);
+  size_t n = names.size();
+  Handle<ArrayObject> arr_obj = ArrayObject::New(n);  // 2
+  for (size_t index = 0; index < n; index++) {  // 4
+    AddValueProperty(arr_obj, NumberToString(index), names[index], true, true, true);
+  }
+  return arr_obj;  // 5
+}
+
 }  // namespace es
 
 #endif  // ES_IMPL_BUILTIN_OBJECT_OBJECT_IMPL_H
\ No newline at end of file
@@ -6,42 +6,50 @@
 
 namespace es {
 
-Handle<JSValue> StringProto::split(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSValue> val = Runtime::TopValue();
+Handle<JSValue> StringProto::split(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSValue> val = this_arg;
   CheckObjectCoercible(e, val);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-  std::u16string S = ToU16String(e, val);
+  Handle<String> S = ::es::ToString(e, val);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   size_t lim = 4294967295.0;
   if (vals.size() >= 2 && !vals[1].val()->IsUndefined()) {
     lim = ToUint32(e, vals[1]);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   }
-  size_t s = S.size();
+  size_t s = S.val()->size();
   size_t p = 0;
   if (lim == 0)
     return ArrayObject::New(0);
   if (vals.size() < 1 || vals[0].val()->IsUndefined()) {  // 10
     Handle<ArrayObject> A = ArrayObject::New(1);
-    AddValueProperty(A, String::Zero(), String::New(S), true, true, true);
+    AddValueProperty(A, String::Zero(), S, true, true, true);
     return A;
   }
   if (vals[0].val()->IsRegExpObject()) {
     assert(false);
   }
   ASSERT(vals[0].val()->IsString());
-  std::u16string R = ToU16String(e, vals[0]);
+  Handle<String> R = ::es::ToString(e, vals[0]);
+  if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   if (s == 0) {
     regex::MatchResult z = regex::SplitMatch(S, 0, R);
     if (!z.failed) return ArrayObject::New(0);
     Handle<ArrayObject> A = ArrayObject::New(1);
-    AddValueProperty(A, String::Zero(), String::New(S), true, true, true);
+    AddValueProperty(A, String::Zero(), S, true, true, true);
     return A;
   }
   size_t length_A = 0;
   size_t q = p;
   std::vector<Handle<String>> segs;
   while (q != s) {  // 13.
+    // SplitMatch fails on every position before the next occurrence of a
+    // non-empty separator, so jump to it directly.
+    if (R.val()->size()) {
+      q = StringFind(S.val(), R.val(), q);
+      if (q == simd::npos)
+        break;
+    }
     regex::MatchResult z = regex::SplitMatch(S, q, R);  // 13.a
     if (z.failed) {  // 13.b
       q++;
@@ -51,13 +59,13 @@ Handle<JSValue> StringProto::split(Handle<Error>& e, Handle<JSValue> this_arg, s
       if (e == p) {  // 13.c.ii
         q++;
       } else {  // 13.c.iii
-        std::u16string T = S.substr(p, q - p);
-        segs.emplace_back(String::New(T));
+        Handle<String> T = String::Substr(S, p, q - p);
+        segs.emplace_back(T);
         length_A++;
         if (length_A == lim) {
           Handle<ArrayObject> A = ArrayObject::New(length_A);
           for (size_t i = 0; i < segs.size(); ++i) {
-            AddValueProperty(A, NumberToString(i), String::New(T), true, true, true);
+            AddValueProperty(A, NumberToString(i), segs[i], true, true, true);
           }
           return A;
         }
@@ -68,7 +76,7 @@ Handle<JSValue> StringProto::split(Handle<Error>& e, Handle<JSValue> this_arg, s
           if (length_A == lim) {
             Handle<ArrayObject> A = ArrayObject::New(length_A);
             for (size_t i = 0; i < segs.size(); ++i) {
-              AddValueProperty(A, NumberToString(i), String::New(T), true, true, true);
+              AddValueProperty(A, NumberToString(i), segs[i], true, true, true);
             }
             return A;
           }
@@ -77,8 +85,8 @@ Handle<JSValue> StringProto::split(Handle<Error>& e, Handle<JSValue> this_arg, s
       }
     }
   }
-  std::u16string T = S.substr(p);  // 14
-  segs.emplace_back(String::New(T));  // 15
+  Handle<String> T = String::Substr(S, p, s - p);  // 14
+  segs.emplace_back(T);  // 15
   length_A++;
 
   Handle<ArrayObject> A = ArrayObject::New(length_A);
@@ -2,31 +2,32 @@
 #define ES_TYPES_CALL_IMPL_H
 
 #include <es/types.h>
+#include <es/enter_code.h>
 
 namespace es {
 
 Handle<JSValue> Call(
-  Handle<Error>& e, Handle<JSValue> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<JSValue> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   if (O.val()->IsFunctionObject()) {
     Handle<FunctionObject> F = static_cast<Handle<FunctionObject>>(O);
     if (!F.val()->from_bind()) {
-      return Call__Function(e, F, this_arg, std::move(arguments));
+      return Call__Function(e, F, this_arg, arguments);
     } else {
-      return Call__BindFunction(e, static_cast<Handle<BindFunctionObject>>(O), this_arg, std::move(arguments));
+      return Call__BindFunction(e, static_cast<Handle<BindFunctionObject>>(O), this_arg, arguments);
     }
   } else if (O.val()->IsConstructor()) {
     switch (O.val()->type()) {
       case Type::OBJ_BOOL_CONSTRUCTOR:
-        return Call__BoolConstructor(e, static_cast<Handle<BoolConstructor>>(O), this_arg, std::move(arguments));
+        return Call__BoolConstructor(e, static_cast<Handle<BoolConstructor>>(O), this_arg, arguments);
       case Type::OBJ_NUMBER_CONSTRUCTOR:
-        return Call__NumberConstructor(e, static_cast<Handle<NumberConstructor>>(O), this_arg, std::move(arguments));
+        return Call__NumberConstructor(e, static_cast<Handle<NumberConstructor>>(O), this_arg, arguments);
       case Type::OBJ_OBJECT_CONSTRUCTOR:
-        return Call__ObjectConstructor(e, static_cast<Handle<ObjectConstructor>>(O), this_arg, std::move(arguments));
+        return Call__ObjectConstructor(e, static_cast<Handle<ObjectConstructor>>(O), this_arg, arguments);
       case Type::OBJ_REGEXP_CONSTRUCTOR:
-        return Call__RegExpConstructor(e, static_cast<Handle<RegExpConstructor>>(O), this_arg, std::move(arguments));
+        return Call__RegExpConstructor(e, static_cast<Handle<RegExpConstructor>>(O), this_arg, arguments);
       case Type::OBJ_STRING_CONSTRUCTOR:
-        return Call__StringConstructor(e, static_cast<Handle<StringConstructor>>(O), this_arg, std::move(arguments));
+        return Call__StringConstructor(e, static_cast<Handle<StringConstructor>>(O), this_arg, arguments);
       case Type::OBJ_FUNC_CONSTRUCTOR:
       case Type::OBJ_ARRAY_CONSTRUCTOR:
       case Type::OBJ_DATE_CONSTRUCTOR:
@@ -35,36 +36,36 @@ Handle<JSValue> Call(
         // 15.5.1.1 Array ( [ value ] )
         // 15.9.2.1 Date ( [ year [, month [, date [, hours [, minutes [, seconds [, ms ] ] ] ] ] ] ] )
         // 15.11.1.1 Error (message)
-        return Call__Construct(e, O, this_arg, std::move(arguments));
+        return Call__Construct(e, O, this_arg, arguments);
       default:
         assert(false);
     }
   } else if (O.val()->IsFunctionProto()) {
-    return Call__FunctionProto(e, static_cast<Handle<FunctionProto>>(O), this_arg, std::move(arguments));
+    return Call__FunctionProto(e, static_cast<Handle<FunctionProto>>(O), this_arg, arguments);
   } else if (O.val()->IsGetterSetter()) {
-    return Call__GetterSetter(e, static_cast<Handle<GetterSetter>>(O), this_arg, std::move(arguments));
+    return Call__GetterSetter(e, static_cast<Handle<GetterSetter>>(O), this_arg, arguments);
   } else {
-    return Call__Base(e, O, this_arg, std::move(arguments));
+    return Call__Base(e, O, this_arg, arguments);
   }
 }
 
 Handle<JSValue> Call__Base(
-  Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   inner_func callable = O.val()->callable();
   ASSERT(O.val()->IsCallable() && callable != nullptr);
-  return callable(e, O, std::move(arguments));
+  return callable(e, this_arg, arguments);
 }
 
 Handle<JSValue> Call__Construct(
-  Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
-  return Construct(e, O, std::move(arguments));
+  return Construct(e, O, arguments);
 }
 
 // 13.2.1 [[Call]]
 Handle<JSValue> Call__Function(
-  Handle<Error>& e, Handle<FunctionObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<FunctionObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   ProgramOrFunctionBody* const code = O.val()->Code()->body();
   TEST_LOG("\033[1;32menter FunctionObject::Call\033[0m\n", code->source(), "\n");
@@ -72,10 +73,11 @@ Handle<JSValue> Call__Function(
   ASSERT(func.val()->IsFunctionObject());
   Handle<EnvironmentRecord> local_env = ExtracGC::TryPopFunctionEnvRec(code);
   if (local_env.IsNullptr()) {
-    local_env = NewDeclarativeEnvironment(func.val()->Scope(), O.val()->Code()->num_decls());
+    local_env = NewDeclarativeEnvironment(func.val()->Scope(), code->binding_names().size());
   } else {
     local_env.val()->SetOuter(func.val()->Scope());
   }
+  LazyArguments lazy_arguments(func, local_env, arguments, O.val()->strict());
   EnterFunctionCode(e, func, code, this_arg, arguments, O.val()->strict(), local_env);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
 
@@ -84,6 +86,7 @@ Handle<JSValue> Call__Function(
     result = EvalProgram(code);
   }
   Runtime::Global()->PopContext();   // 3
+  lazy_arguments.MaterializeIfEscaped();
   ExtracGC::TrySaveFunctionEnvRec(code, local_env);
   TEST_LOG("\033[1;32mexit FunctionObject::Call\033[0m");
   switch (result.type()) {
@@ -115,31 +118,31 @@ Handle<JSValue> Call__Function(
 }
 
 Handle<JSValue> Call__BindFunction(
-  Handle<Error>& e, Handle<BindFunctionObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> extra_args
+  Handle<Error>& e, Handle<BindFunctionObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> extra_args
 ) {
   TEST_LOG("\033[2menter\033[0m BindFunctionObject::Call");
   Handle<FixedArray> bound_args = O.val()->BoundArgs();
   Handle<JSObject> target_function = O.val()->TargetFunction();
 
-  std::vector<Handle<JSValue>> args;
+  ArgumentWindow args;
   for (size_t i = 0; i < bound_args.val()->size(); i++) {
-    args.emplace_back(bound_args.val()->Get(i));
+    args.Add(bound_args.val()->Get(i));
   }
-  args.insert(args.end(), extra_args.begin(), extra_args.end());
-  return Call(e, target_function, O.val()->BoundThis(), args);
+  args.Add(extra_args);
+  return Call(e, target_function, O.val()->BoundThis(), args.span());
 }
 
 // 15.3.4 The Function prototype object is itself a Function object (its [[Class]] is "Function") that,
 // when invoked, accepts any arguments and returns undefined.
 Handle<JSValue> Call__FunctionProto(
-  Handle<Error>& e, Handle<FunctionProto> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<FunctionProto> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   return Undefined::Instance();
 }
 
 // 15.6.1.1 Boolean (value)
 Handle<JSValue> Call__BoolConstructor(
-  Handle<Error>& e, Handle<BoolConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<BoolConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   bool b;
   if (arguments.size() == 0)
@@ -151,7 +154,7 @@ Handle<JSValue> Call__BoolConstructor(
 
 // 15.7.1.1 Number ( [ value ] )
 Handle<JSValue> Call__NumberConstructor(
-  Handle<Error>& e, Handle<NumberConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<NumberConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   Handle<Number> js_num;
   if (arguments.size() == 0) {
@@ -166,16 +169,16 @@ Handle<JSValue> Call__NumberConstructor(
 
 // 15.2.1.1 Object ( [ value ] )
 Handle<JSValue> Call__ObjectConstructor(
-  Handle<Error>& e, Handle<ObjectConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<ObjectConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 0 || arguments[0].val()->IsNull() || arguments[0].val()->IsUndefined())
-    return Construct(e, O, std::move(arguments));
+    return Construct(e, O, arguments);
   return ToObject(e, arguments[0]);
 }
 
 // 15.10.4.1 new RegExp(pattern, flags)
 Handle<JSValue> Call__RegExpConstructor(
-  Handle<Error>& e, Handle<RegExpConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<RegExpConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 0) {
     e = Error::TypeError(u"RegExp called with 0 parameters");
@@ -184,12 +187,12 @@ Handle<JSValue> Call__RegExpConstructor(
   if ((arguments.size() == 1 || arguments[1].val()->IsUndefined()) && arguments[0].val()->IsRegExpObject()) {
       return arguments[0];
   }
-  return Construct(e, O, std::move(arguments));
+  return Construct(e, O, arguments);
 }
 
 // 15.5.1.1 String ( [ value ] )
 Handle<JSValue> Call__StringConstructor(
-  Handle<Error>& e, Handle<StringConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<StringConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 0)
     return String::Empty();
@@ -197,7 +200,7 @@ Handle<JSValue> Call__StringConstructor(
 }
 
 Handle<JSValue> Call__GetterSetter(
-  Handle<Error>& e, Handle<GetterSetter> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<GetterSetter> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments
 ) {
   ASSERT(arguments.size() < 2);
   Handle<GetterSetter> gs = static_cast<Handle<GetterSetter>>(O);
@@ -5,34 +5,34 @@
 
 namespace es {
 
-Handle<JSObject> Construct(Handle<Error>& e, Handle<JSObject> O, std::vector<Handle<JSValue>> arguments) {
+Handle<JSObject> Construct(Handle<Error>& e, Handle<JSObject> O, Span<Handle<JSValue>> arguments) {
   if (O.val()->IsFunctionObject()) {
     Handle<FunctionObject> F = static_cast<Handle<FunctionObject>>(O);
     if (!F.val()->from_bind()) {
-      return Construct__Function(e, F, std::move(arguments));
+      return Construct__Function(e, F, arguments);
     } else {
-      return Construct__BindFunction(e, static_cast<Handle<BindFunctionObject>>(O), std::move(arguments));
+      return Construct__BindFunction(e, static_cast<Handle<BindFunctionObject>>(O), arguments);
     }
   } else if (O.val()->IsConstructor()) {
     switch (O.val()->type()) {
       case Type::OBJ_BOOL_CONSTRUCTOR:
-        return Construct__BoolConstructor(e, static_cast<Handle<BoolConstructor>>(O), std::move(arguments));
+        return Construct__BoolConstructor(e, static_cast<Handle<BoolConstructor>>(O), arguments);
       case Type::OBJ_NUMBER_CONSTRUCTOR:
-        return Construct__NumberConstructor(e, static_cast<Handle<NumberConstructor>>(O), std::move(arguments));
+        return Construct__NumberConstructor(e, static_cast<Handle<NumberConstructor>>(O), arguments);
       case Type::OBJ_OBJECT_CONSTRUCTOR:
-        return Construct__ObjectConstructor(e, static_cast<Handle<ObjectConstructor>>(O), std::move(arguments));
+        return Construct__ObjectConstructor(e, static_cast<Handle<ObjectConstructor>>(O), arguments);
       case Type::OBJ_REGEXP_CONSTRUCTOR:
-        return Construct__RegExpConstructor(e, static_cast<Handle<RegExpConstructor>>(O), std::move(arguments));
+        return Construct__RegExpConstructor(e, static_cast<Handle<RegExpConstructor>>(O), arguments);
       case Type::OBJ_STRING_CONSTRUCTOR:
-        return Construct__StringConstructor(e, static_cast<Handle<StringConstructor>>(O), std::move(arguments));
+        return Construct__StringConstructor(e, static_cast<Handle<StringConstructor>>(O), arguments);
       case Type::OBJ_FUNC_CONSTRUCTOR:
-        return Construct__FunctionConstructor(e, static_cast<Handle<FunctionConstructor>>(O), std::move(arguments));
+        return Construct__FunctionConstructor(e, static_cast<Handle<FunctionConstructor>>(O), arguments);
       case Type::OBJ_ARRAY_CONSTRUCTOR:
-        return Construct__ArrayConstructor(e, static_cast<Handle<ArrayConstructor>>(O), std::move(arguments));
+        return Construct__ArrayConstructor(e, static_cast<Handle<ArrayConstructor>>(O), arguments);
       case Type::OBJ_DATE_CONSTRUCTOR:
         assert(false);
       case Type::OBJ_ERROR_CONSTRUCTOR:
-        return Construct__ErrorConstructor(e, static_cast<Handle<ErrorConstructor>>(O), std::move(arguments));
+        return Construct__ErrorConstructor(e, static_cast<Handle<ErrorConstructor>>(O), arguments);
       default:
         assert(false);
     }
@@ -42,7 +42,7 @@ Handle<JSObject> Construct(Handle<Error>& e, Handle<JSObject> O, std::vector<Han
 
 // 13.2.2 [[Construct]]
 Handle<JSObject> Construct__Function(
-  Handle<Error>& e, Handle<FunctionObject> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<FunctionObject> O, Span<Handle<JSValue>> arguments
 ) {
   TEST_LOG("\033[2menter\033[0m FunctionObject::Construct");
   // NOTE(zhuzilin) I'm not sure if the object type should be OBJ_OBJECT or OBJ_OTHER...
@@ -58,9 +58,9 @@ Handle<JSObject> Construct__Function(
   } else {  // 7
     obj.val()->SetPrototype(ObjectProto::Instance());
   }
-  Handle<JSValue> result = Call(e, O, obj, std::move(arguments));  // 8
+  Handle<JSValue> result = Call(e, O, obj, arguments);  // 8
   // get more accurate num_decls from runtime.
-  func_ast->body()->SetNumThisProperties(obj.val()->named_properties()->hashmap().val()->occupancy());
+  func_ast->body()->SetNumThisProperties(obj.val()->named_properties()->occupancy());
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   if (result.val()->IsObject())  // 9
     return static_cast<Handle<JSObject>>(result);
@@ -69,7 +69,7 @@ Handle<JSObject> Construct__Function(
 
 // 13.2.2 [[Construct]]
 Handle<JSObject> Construct__BindFunction(
-  Handle<Error>& e, Handle<BindFunctionObject> O, std::vector<Handle<JSValue>> extra_args
+  Handle<Error>& e, Handle<BindFunctionObject> O, Span<Handle<JSValue>> extra_args
 ) {
   auto target_function = O.val()->TargetFunction();
   auto bound_args = O.val()->BoundArgs();
@@ -77,17 +77,17 @@ Handle<JSObject> Construct__BindFunction(
     e = Error::TypeError(u"target function has no [[Construct]] internal method");
     return Handle<JSValue>();
   }
-  std::vector<Handle<JSValue>> args;
+  ArgumentWindow args;
   for (size_t i = 0; i < bound_args.val()->size(); i++) {
-    args.emplace_back(bound_args.val()->Get(i));
+    args.Add(bound_args.val()->Get(i));
   }
-  args.insert(args.end(), extra_args.begin(), extra_args.end());
-  return Construct(e, target_function, args);
+  args.Add(extra_args);
+  return Construct(e, target_function, args.span());
 }
 
 // 15.5.2.1 new Array ( [ value ] )
 Handle<JSObject> Construct__ArrayConstructor(
-  Handle<Error>& e, Handle<ArrayConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<ArrayConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 1 && arguments[0].val()->IsNumber()) {
     Handle<Number> len = static_cast<Handle<Number>>(arguments[0]);
@@ -107,7 +107,7 @@ Handle<JSObject> Construct__ArrayConstructor(
 }
 
 Handle<JSObject> Construct__BoolConstructor(
-  Handle<Error>& e, Handle<BoolConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<BoolConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   bool b;
   if (arguments.size() == 0)
@@ -118,7 +118,7 @@ Handle<JSObject> Construct__BoolConstructor(
 }
 
 Handle<JSObject> Construct__ErrorConstructor(
-  Handle<Error>& e, Handle<ErrorConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<ErrorConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 0 || arguments[0].val()->IsUndefined())
     return ErrorObject::New(Error::NativeError(Undefined::Instance()));
@@ -127,7 +127,7 @@ Handle<JSObject> Construct__ErrorConstructor(
 
 // 15.3.2.1 new Function (p1, p2, … , pn, body)
 Handle<JSObject> Construct__FunctionConstructor(
-  Handle<Error>& e, Handle<FunctionConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<FunctionConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   TEST_LOG("\033[2menter\033[0m FunctionConstructor::Construct");
   size_t arg_count = arguments.size();
@@ -140,7 +140,8 @@ Handle<JSObject> Construct__FunctionConstructor(
     P += ToU16String(e, arguments[0]);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     for (size_t i = 1; i < arg_count - 1; i++) {
-      P += u"," + ToU16String(e, arguments[i]);
+      P += u',';
+      P += ToU16String(e, arguments[i]);
       if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     }
     body = ToU16String(e, arguments[arg_count - 1]);
@@ -184,7 +185,7 @@ Handle<JSObject> Construct__FunctionConstructor(
 }
 
 Handle<JSObject> Construct__NumberConstructor(
-  Handle<Error>& e, Handle<NumberConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<NumberConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   Handle<Number> js_num;
   if (arguments.size() == 0) {
@@ -199,7 +200,7 @@ Handle<JSObject> Construct__NumberConstructor(
 
 // 15.2.2 The Object Constructor
 Handle<JSObject> Construct__ObjectConstructor(
-  Handle<Error>& e, Handle<ObjectConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<ObjectConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() > 0) {  // 1
     Handle<JSValue> value = arguments[0];
@@ -222,7 +223,7 @@ Handle<JSObject> Construct__ObjectConstructor(
 }
 
 Handle<JSObject> Construct__RegExpConstructor(
-  Handle<Error>& e, Handle<RegExpConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<RegExpConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   Handle<String> P, F;
   if (arguments.size() == 0) {
@@ -265,7 +266,7 @@ Handle<JSObject> Construct__RegExpConstructor(
     }
   }
   if (!valid_flag) {
-    e = Error::SyntaxError(u"invalid RegExp flag: " + F.val()->data());
+    e = Error::SyntaxError(u"invalid RegExp flag: ", F);
     return Handle<JSValue>();
   }
   return RegExpObject::New(P, F);
@@ -273,7 +274,7 @@ Handle<JSObject> Construct__RegExpConstructor(
 
 // 15.5.2.1 String::New ( [ value ] )
 Handle<JSObject> Construct__StringConstructor(
-  Handle<Error>& e, Handle<StringConstructor> O, std::vector<Handle<JSValue>> arguments
+  Handle<Error>& e, Handle<StringConstructor> O, Span<Handle<JSValue>> arguments
 ) {
   if (arguments.size() == 0)
     return StringObject::New(String::Empty());
@@ -2,6 +2,7 @@
 #define ES_TYPES_ENVIRONMENT_RECORD_IMPLE_H
 
 #include <es/types/environment_record.h>
+#include <es/enter_code.h>
 
 namespace es {
 
@@ -136,9 +137,11 @@ Handle<JSValue> GetBindingValue__Declarative(
   // This will always get value.
   JSValue* V = env_rec.val()->bindings()->GetRaw(N, entry_fn);
   ASSERT(V != nullptr);
+  if (unlikely(V == ArgumentsObject::Pending()))
+    return LazyArguments::Materialize(env_rec);
   if (is_immutable_undefined) {
     if (S) {
-      e = Error::ReferenceError(N.val()->data() + u" is not defined");
+      e = Error::ReferenceError(u"", N, u" is not defined");
       return Handle<JSValue>();
     } else {
       if (unlikely(log::Debugger::On()))
@@ -158,7 +161,7 @@ Handle<JSValue> GetBindingValue__Object(
   StackPropertyDescriptor desc = GetProperty(env_rec.val()->bindings(), N);
   if (desc.IsUndefined()) {
     if (S) {
-      e = Error::ReferenceError(N.val()->data() + u" is not defined");
+      e = Error::ReferenceError(u"", N, u" is not defined");
       return Handle<JSValue>();
     } else {
       return Undefined::Instance();
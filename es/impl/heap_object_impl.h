@@ -40,31 +40,24 @@ std::vector<HeapObject**> HeapObject::Pointers(HeapObject* heap_obj) {
     case JS_UNDEFINED:
     case JS_NULL:
     case JS_BOOL:
-    case JS_LONG_STRING:
-    case JS_STRING:
     case JS_NUMBER:
     case JS_REF:
       return {};
+    case JS_LONG_STRING:
+    case JS_STRING:
+      if (reinterpret_cast<String*>(heap_obj)->IsSliced())
+        return {HEAP_PTR(heap_obj, String::kParentOffset)};
+      return {};
     case JS_GET_SET:
       return {
         HEAP_PTR(heap_obj, GetterSetter::kBaseOffset),
         HEAP_PTR(heap_obj, GetterSetter::kReferenceNameOffset)
       };
-    case JS_PROP_DESC: {
-      PropertyDescriptor* desc = reinterpret_cast<PropertyDescriptor*>(heap_obj);
-      if (desc->IsDataDescriptor()) {
-        return {
-          HEAP_PTR(heap_obj, PropertyDescriptor::kValueOffset)
-        };
-      } else if (desc->IsAccessorDescriptor()){
-        return {
-          HEAP_PTR(heap_obj, PropertyDescriptor::kGetOffset),
-          HEAP_PTR(heap_obj, PropertyDescriptor::kSetOffset)
-        };
-      } else {
-        assert(false);
-      }
-    }
+    case JS_ACCESSOR_PAIR:
+      return {
+        HEAP_PTR(heap_obj, AccessorPair::kGetOffset),
+        HEAP_PTR(heap_obj, AccessorPair::kSetOffset)
+      };
     case JS_ENV_REC_DECL:
       return {
         HEAP_PTR(heap_obj, EnvironmentRecord::kOuterOffset),
@@ -90,14 +83,14 @@ std::vector<HeapObject**> HeapObject::Pointers(HeapObject* heap_obj) {
     case HASHMAP_V2: {
       HashMapV2* map = reinterpret_cast<HashMapV2*>(heap_obj);
       std::vector<HeapObject**> pointers;
-      for (size_t i = 0; i < map->capacity(); ++i) {
-        HashMapV2::Entry* p = map->map_start() + i;
+      for (HashMapV2::Entry* p = map->map_start(); p < map->map_end(); ++p) {
         if (!p->is_empty()) {
           pointers.emplace_back(HEAP_PTR(p, 0));
           pointers.emplace_back(HEAP_PTR(p, kPtrSize));
         }
       }
       ASSERT(pointers.size() == 2 * map->occupancy());
+      pointers.emplace_back(HEAP_PTR(heap_obj, HashMapV2::kEnumCacheOffset));
       return pointers;
     }
     case HASHMAP: {
@@ -108,15 +101,6 @@ std::vector<HeapObject**> HeapObject::Pointers(HeapObject* heap_obj) {
       }
       return pointers;
     }
-    case PROPERTY_MAP: {
-      size_t n = READ_VALUE(heap_obj, PropertyMap::kNumFixedSlotsOffset, size_t);
-      std::vector<HeapObject**> pointers(n + 1);
-      for (size_t i = 0; i < n; i++) {
-        pointers[i] = HEAP_PTR(heap_obj, PropertyMap::kElementOffset + i * kPtrSize);
-      }
-      pointers[n] = HEAP_PTR(heap_obj, PropertyMap::kHashMapOffset);
-      return pointers;
-    }
     case LIST_NODE: {
       return {
         HEAP_PTR(heap_obj, ListNode::kKeyOffset),
@@ -129,8 +113,12 @@ std::vector<HeapObject**> HeapObject::Pointers(HeapObject* heap_obj) {
       if (obj->IsObject()) {
         std::vector<HeapObject**> pointers {
           HEAP_PTR(heap_obj, JSObject::kPrototypeOffset),
-          HEAP_PTR(heap_obj, JSObject::kNamedPropertiesOffset) 
+          HEAP_PTR(heap_obj, JSObject::kNamedPropertiesOffset)
         };
+        PropertyMap* map = obj->named_properties();
+        for (size_t i = 0; i < map->num_fixed_slots(); ++i) {
+          pointers.emplace_back(HEAP_PTR(map->GetSlot(i), 0));
+        }
         if (obj->HasPrimitiveValue()) {
           pointers.emplace_back(HEAP_PTR(heap_obj, FunctionObject::kPrimitiveValueOffset));
         }
@@ -145,6 +133,15 @@ std::vector<HeapObject**> HeapObject::Pointers(HeapObject* heap_obj) {
             pointers.emplace_back(HEAP_PTR(heap_obj, BindFunctionObject::kBoundArgsOffset));
             break;
           }
+          case OBJ_ARGUMENTS: {
+            pointers.emplace_back(HEAP_PTR(heap_obj, ArgumentsObject::kCalleeOffset));
+            pointers.emplace_back(HEAP_PTR(heap_obj, ArgumentsObject::kEnvOffset));
+            break;
+          }
+          case OBJ_ERROR: {
+            pointers.emplace_back(HEAP_PTR(heap_obj, ErrorObject::kMessageNameOffset));
+            break;
+          }
           case OBJ_REGEXP: {
             pointers.emplace_back(HEAP_PTR(heap_obj, RegExpObject::kPatternOffset));
             pointers.emplace_back(HEAP_PTR(heap_obj, RegExpObject::kFlagOffset));
@@ -246,8 +243,8 @@ std::string HeapObject::ToString(Type type) {
       return "JS_REF";
     case JS_GET_SET:
       return "JS_GET_SET";
-    case JS_PROP_DESC:
-      return "JS_PROP_DESC";
+    case JS_ACCESSOR_PAIR:
+      return "JS_ACCESSOR_PAIR";
     case JS_ENV_REC_DECL:
       return "JS_ENV_REC_DECL";
     case JS_ENV_REC_OBJ:
@@ -264,8 +261,6 @@ std::string HeapObject::ToString(Type type) {
       return "HASHMAP_V2";
     case HASHMAP:
       return "HASHMAP";
-    case PROPERTY_MAP:
-      return "PROPERTY_MAP";
     case LIST_NODE:
       return "LIST_NODE";
     default:
@@ -9,8 +9,13 @@ namespace es {
 StackPropertyDescriptor GetOwnProperty(Handle<JSObject> O, Handle<String> P) {
   if (O.val()->IsStringObject()) {
     return GetOwnProperty__String(static_cast<Handle<StringObject>>(O), P);
+  } else if (O.val()->IsArgumentsObject()) {
+    return GetOwnProperty__Arguments(static_cast<Handle<ArgumentsObject>>(O), P);
+  } else if (unlikely(O.val()->named_properties()->has_pending_properties())) {
+    if (O.val()->IsErrorObject())
+      return GetOwnProperty__Error(static_cast<Handle<ErrorObject>>(O), P);
+    return GetOwnProperty__Function(static_cast<Handle<FunctionObject>>(O), P);
   }
-  // merge 10.6 to here.
   return GetOwnProperty__Base(O, P);
 }
 
@@ -41,6 +46,37 @@ StackPropertyDescriptor GetOwnProperty__String(Handle<StringObject> O, Handle<St
   return desc;
 }
 
+// 10.6 [[GetOwnProperty]] (P)
+StackPropertyDescriptor GetOwnProperty__Arguments(Handle<ArgumentsObject> O, Handle<String> P) {
+  StackPropertyDescriptor desc = GetOwnProperty__Base(O, P);
+  if (O.val()->IsMapped(P)) {  // 5
+    Handle<Error> e = Error::Ok();
+    desc.SetValue(GetBindingValue(e, O.val()->env(), O.val()->ParameterName(P), false));
+  }
+  return desc;
+}
+
+StackPropertyDescriptor GetOwnProperty__Function(Handle<FunctionObject> O, Handle<String> P) {
+  if (FunctionObject::IsPendingProperty(P))
+    FunctionObject::MaterializeProperties(O);
+  return GetOwnProperty__Base(O, P);
+}
+
+StackPropertyDescriptor GetOwnProperty__Error(Handle<ErrorObject> O, Handle<String> P) {
+  if (ErrorObject::IsPendingProperty(P))
+    ErrorObject::MaterializeProperties(O);
+  return GetOwnProperty__Base(O, P);
+}
+
+// Whether P is a property of O that is not created yet.
+bool IsPendingProperty(JSObject* O, Handle<String> P) {
+  if (likely(!O->named_properties()->has_pending_properties()))
+    return false;
+  if (O->IsErrorObject())
+    return ErrorObject::IsPendingProperty(P);
+  return FunctionObject::IsPendingProperty(P);
+}
+
 // [[GetProperty]]
 // 8.12.2 [[GetProperty]] (P)
 StackPropertyDescriptor GetProperty(Handle<JSObject> O, Handle<String> P) {
@@ -53,8 +89,29 @@ StackPropertyDescriptor GetProperty(Handle<JSObject> O, Handle<String> P) {
     return StackPropertyDescriptor::Undefined();
   }
   ASSERT(proto.val()->IsObject());
-  Handle<JSObject> proto_obj = static_cast<Handle<JSObject>>(proto);
-  return GetProperty(proto_obj, P);
+  // String objects have the indices as their own properties, so only the
+  // other names are cached, which are always in the hashmap.
+  if (P.val()->IsArrayIndex()) {
+    Handle<JSObject> proto_obj = static_cast<Handle<JSObject>>(proto);
+    return GetProperty(proto_obj, P);
+  }
+  PrototypeLookupCache::Entry* entry = PrototypeLookupCache::Slot(proto.val(), P.val());
+  if (!PrototypeLookupCache::IsHit(entry, proto.val(), P.val())) {
+    // No heap allocation in the walk, so raw pointers are fine.
+    HashMapV2::Entry* p = nullptr;
+    JSValue* obj = proto.val();
+    while (p == nullptr && !obj->IsNull()) {
+      // The property is not created yet, and creating it would allocate.
+      if (unlikely(IsPendingProperty(static_cast<JSObject*>(obj), P)))
+        return GetProperty(Handle<JSObject>(static_cast<JSObject*>(obj)), P);
+      p = static_cast<JSObject*>(obj)->named_properties()->GetEntry(P);
+      obj = static_cast<JSObject*>(obj)->Prototype().val();
+    }
+    *entry = {proto.val(), P.val(), p, PrototypeLookupCache::epoch};
+  }
+  if (entry->holder_entry == nullptr)
+    return StackPropertyDescriptor::Undefined();
+  return ToStack(entry->holder_entry);
 }
 
 // [[Get]]
@@ -108,6 +165,8 @@ Handle<JSValue> Get__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Hand
       return Handle<JSValue>();
     }
   }
+  if (O.val()->IsMapped(P))  // 4
+    return GetBindingValue(e, O.val()->env(), O.val()->ParameterName(P), false);
   Handle<JSValue> V = Get__Base(e, O, P);
   return V;
 }
@@ -140,45 +199,71 @@ bool CanPut(Handle<JSObject> O, Handle<String> P) {
   }
 }
 
-bool UpdatePropertyDescriptor(
+// `p` is either a PropertyMap::Slot or a HashMapV2::Entry of O.
+template<typename Attributes>
+bool UpdateInlineProperty(
     Handle<Error>& e,
-    Handle<PropertyDescriptor> desc,
+    Attributes* p,
     Handle<JSObject> O,
     Handle<String> P,
     Handle<JSValue> V,
     bool throw_flag
 ) {
-  ASSERT(!desc.IsNullptr());
-  if (desc.val()->IsAccessorDescriptor()) {
-    Handle<JSValue> setter = desc.val()->Set();
+  if (p->val->IsAccessorPair()) {
+    Handle<JSValue> setter = static_cast<AccessorPair*>(p->val)->Set();
     if (unlikely(setter.val()->IsUndefined())) {
       if (throw_flag) {
-        e = Error::TypeError(u"cannot put " + P.val()->data());
+        e = Error::TypeError(u"cannot put ", P);
       }
       return true;
     }
     Call(e, setter, O, {V});
     return true;
-  } else {
-    ASSERT(desc.val()->IsDataDescriptor());
-    if (unlikely(!desc.val()->Writable())) {
-      if (throw_flag) {
-        e = Error::TypeError(u"cannot put " + P.val()->data());
-      }
-      return true;
+  }
+  if (unlikely(!p->writable)) {
+    if (throw_flag) {
+      e = Error::TypeError(u"cannot put ", P);
     }
-    desc.val()->SetValue(V);
+    return true;
   }
+  p->val = V.val();
   return true;
 }
 
 bool UpdateOwnProperty(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
   if (O.val()->IsArrayObject()) {
     return UpdateOwnProperty__ArrayObject(e, O, P, V, throw_flag);
+  } else if (O.val()->IsArgumentsObject()) {
+    return UpdateOwnProperty__Arguments(e, static_cast<Handle<ArgumentsObject>>(O), P, V, throw_flag);
+  } else if (unlikely(O.val()->named_properties()->has_pending_properties())) {
+    if (O.val()->IsErrorObject())
+      return UpdateOwnProperty__Error(e, static_cast<Handle<ErrorObject>>(O), P, V, throw_flag);
+    return UpdateOwnProperty__Function(e, static_cast<Handle<FunctionObject>>(O), P, V, throw_flag);
   }
   return UpdateOwnProperty__Base(e, O, P, V, throw_flag);
 }
 
+bool UpdateOwnProperty__Error(Handle<Error>& e, Handle<ErrorObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
+  if (ErrorObject::IsPendingProperty(P))
+    ErrorObject::MaterializeProperties(O);
+  return UpdateOwnProperty__Base(e, O, P, V, throw_flag);
+}
+
+bool UpdateOwnProperty__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
+  if (FunctionObject::IsPendingProperty(P))
+    FunctionObject::MaterializeProperties(O);
+  return UpdateOwnProperty__Base(e, O, P, V, throw_flag);
+}
+
+// A mapped index is a writable data property, so the put goes to both
+// the property and the parameter, as 10.6 [[DefineOwnProperty]] step 5.b.
+bool UpdateOwnProperty__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
+  bool updated = UpdateOwnProperty__Base(e, O, P, V, throw_flag);
+  if (O.val()->IsMapped(P))
+    SetMutableBinding(e, O.val()->env(), O.val()->ParameterName(P), V, throw_flag);
+  return updated;
+}
+
 bool UpdateOwnProperty__ArrayObject(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
   bool is_array_index = P.val()->IsArrayIndex();
   if (!is_array_index && !StringEqual(P, String::Length())) {
@@ -204,7 +289,7 @@ bool UpdateOwnProperty__ArrayObject(Handle<Error>& e, Handle<JSObject> O, Handle
   if (desc.IsDataDescriptor()) {
     if (!desc.Writable()) {
       if (throw_flag) {
-        e = Error::TypeError(u"cannot put " + P.val()->data());
+        e = Error::TypeError(u"cannot put ", P);
       }
       return true;
     }
@@ -215,7 +300,7 @@ bool UpdateOwnProperty__ArrayObject(Handle<Error>& e, Handle<JSObject> O, Handle
     ASSERT(desc.IsAccessorDescriptor());
     if (desc.Set().val()->IsUndefined()) {
       if (throw_flag) {
-        e = Error::TypeError(u"cannot put " + P.val()->data());
+        e = Error::TypeError(u"cannot put ", P);
       }
       return true;
     }
@@ -230,48 +315,23 @@ bool UpdateOwnProperty__ArrayObject(Handle<Error>& e, Handle<JSObject> O, Handle
 // if error, return true
 // otherwise return false, so that Put could check the prototype.
 bool UpdateOwnProperty__Base(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag) {
-  Handle<PropertyMap> map(O.val()->named_properties());
-  if (map.val()->IsSmallArrayIndex(P)) {
-    uint32_t index = P.val()->Index();
-    Handle<PropertyDescriptor> desc(
-        static_cast<PropertyDescriptor*>(map.val()->GetRawArray(index)));
-    if (desc.IsNullptr()) {
-      if (unlikely(O.val()->IsStringObject() && P.val()->IsArrayIndex())) {
-        if (throw_flag) {
-          e = Error::TypeError(u"cannot put " + P.val()->data());
-        }
-        return true;
-      }
-      return false;
-    }
-    return UpdatePropertyDescriptor(e, desc, O, P, V, throw_flag);
+  PropertyMap* map = O.val()->named_properties();
+  if (map->IsSmallArrayIndex(P)) {
+    PropertyMap::Slot* p = map->GetSlot(P.val()->Index());
+    if (!p->is_empty())
+      return UpdateInlineProperty(e, p, O, P, V, throw_flag);
   } else {
-    HashMapV2::Entry* p = map.val()->hashmap().val()->GetEntry(P);
-    if (p == nullptr) {
-      if (unlikely(O.val()->IsStringObject() && P.val()->IsArrayIndex())) {
-        if (throw_flag) {
-          e = Error::TypeError(u"cannot put " + P.val()->data());
-        }
-        return true;
-      }
-      return false;
-    }
-
-    if (p->val->IsPropertyDescriptor()) {
-      Handle<PropertyDescriptor> desc(static_cast<PropertyDescriptor*>(p->val));
-      return UpdatePropertyDescriptor(e, desc, O, P, V, throw_flag);
-    } else {
-      if (unlikely(!p->writable)) {
-        if (throw_flag) {
-          e = Error::TypeError(u"cannot put " + P.val()->data());
-          return true;
-        }
-        return true;
-      }
-      p->val = V.val();
+    HashMapV2::Entry* p = map->GetEntry(P);
+    if (p != nullptr)
+      return UpdateInlineProperty(e, p, O, P, V, throw_flag);
+  }
+  if (unlikely(O.val()->IsStringObject() && P.val()->IsArrayIndex())) {
+    if (throw_flag) {
+      e = Error::TypeError(u"cannot put ", P);
     }
     return true;
   }
+  return false;
 }
 
 // [[Put]]
@@ -291,7 +351,7 @@ void Put(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue>
       bool can_put = O.val()->Extensible();
       if (!can_put) {
         if (throw_flag) {  // 1.a
-          e = Error::TypeError(u"cannot put " + P.val()->data());
+          e = Error::TypeError(u"cannot put ", P);
         }
         return;  // 1.b
       }
@@ -299,7 +359,7 @@ void Put(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue>
       bool can_put = !inherit.Set().val()->IsUndefined();
       if (!can_put) {
         if (throw_flag) {  // 1.a
-          e = Error::TypeError(u"cannot put " + P.val()->data());
+          e = Error::TypeError(u"cannot put ", P);
         }
         return;  // 1.b
       }
@@ -312,7 +372,7 @@ void Put(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue>
       bool can_put = O.val()->Extensible() ? inherit.Writable() : false;
       if (!can_put) {
         if (throw_flag) {  // 1.a
-          e = Error::TypeError(u"cannot put " + P.val()->data());
+          e = Error::TypeError(u"cannot put ", P);
         }
         return;  // 1.b
       }
@@ -350,14 +410,17 @@ bool Delete__Base(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, bool t
     return true;
   } else {
     if (throw_flag) {
-      e = Error::TypeError(P.val()->data() + u" not configurable, therefore failed to delete");
+      e = Error::TypeError(u"", P, u" not configurable, therefore failed to delete");
     }
     return false;
   }
 }
 
+// 10.6 [[Delete]] (P, Throw)
 bool Delete__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, bool throw_flag) {
   bool result = Delete__Base(e, O, P, throw_flag);
+  if (result && O.val()->IsMapped(P))  // 4
+    O.val()->Unmap(P);
   return result;
 }
 
@@ -384,9 +447,6 @@ Handle<JSValue> DefaultValue(Handle<Error>& e, Handle<JSObject> O) {
     assert(false);
   }
 
-  ValueGuard guard;
-  guard.AddValue(O);
-
   Handle<JSValue> to_string = Get(e, O, first);
   if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
   if (to_string.val()->IsCallable()) {
@@ -418,11 +478,44 @@ bool DefineOwnProperty(
   TEST_LOG("\033[2menter\033[0m DefineOwnProperty " + HeapObject::ToString(O.val()->type()) + "." + P.ToString() + " = " + desc.ToString());
   if (O.val()->IsArrayObject()) {
     return DefineOwnProperty__Array(e, static_cast<Handle<ArrayObject>>(O), P, desc, throw_flag);
+  } else if (O.val()->IsArgumentsObject()) {
+    return DefineOwnProperty__Arguments(e, static_cast<Handle<ArgumentsObject>>(O), P, desc, throw_flag);
   } else {
     return DefineOwnProperty__Base(e, O, P, desc, throw_flag);
   }
 }
 
+// 10.6 [[DefineOwnProperty]] (P, Desc, Throw)
+bool DefineOwnProperty__Arguments(
+  Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, StackPropertyDescriptor desc, bool throw_flag
+) {
+  bool is_mapped = O.val()->IsMapped(P);
+  if (is_mapped) {
+    // The property keeps the value of the parameter once unmapped.
+    PropertyMap::Slot* p = O.val()->named_properties()->GetSlot(P.val()->Index());
+    p->val = GetBindingValue(e, O.val()->env(), O.val()->ParameterName(P), false).val();
+  }
+  bool allowed = DefineOwnProperty__Base(e, O, P, desc, false);  // 3
+  if (!allowed) {  // 4
+    if (throw_flag)
+      e = Error::TypeError(u"failed to DefineOwnProperty ", P);
+    return false;
+  }
+  if (is_mapped) {  // 5
+    if (desc.IsAccessorDescriptor()) {  // 5.a
+      O.val()->Unmap(P);
+    } else {
+      if (desc.HasValue()) {  // 5.b.i
+        SetMutableBinding(e, O.val()->env(), O.val()->ParameterName(P), desc.Value(), throw_flag);
+        if (unlikely(!e.val()->IsOk())) return false;
+      }
+      if (desc.HasWritable() && !desc.Writable())  // 5.b.ii
+        O.val()->Unmap(P);
+    }
+  }
+  return true;
+}
+
 bool DefineOwnProperty__Base(
   Handle<Error>& e, Handle<JSObject> O, Handle<String> P, StackPropertyDescriptor desc, bool throw_flag
 ) {
@@ -434,7 +527,7 @@ bool DefineOwnProperty__Base(
       goto reject;
     }
     // 4.
-    PropertyMap::Set(Handle<PropertyMap>(O.val()->named_properties()), P, desc);
+    PropertyMap::Set(O, P, desc);
     return true;
   }
   if (desc.bitmask() == 0) {  // 5
@@ -496,7 +589,7 @@ bool DefineOwnProperty__Base(
   TEST_LOG("DefineOwnProperty: " + P.ToString() + " is set to " + desc.Value().ToString());
   // 12.
   current.Set(desc);
-  PropertyMap::Set(Handle<PropertyMap>(O.val()->named_properties()), P, current);
+  PropertyMap::Set(O, P, current);
   // 13.
   return true;
 reject:
@@ -633,13 +726,13 @@ bool HasInstance__Function(Handle<Error>& e, Handle<FunctionObject> obj, Handle<
     e = Error::TypeError();
     return false;
   }
-  while (!V.val()->IsNull()) {
-    if (V.val() == O.val())
+  while (true) {  // 4
+    V = static_cast<Handle<JSObject>>(V).val()->Prototype();  // 4.a
+    if (V.val()->IsNull())  // 4.b
+      return false;
+    if (V.val() == O.val())  // 4.c
       return true;
-    V = Get(e, static_cast<Handle<JSObject>>(V), String::Prototype());
-    if (unlikely(!e.val()->IsOk())) return false;
   }
-  return false;
 }
 
 // 15.3.4.5.3 [[HasInstance]] (V)
@@ -656,7 +749,7 @@ void AddValueProperty(
     value, writable, enumerable, configurable);
   // This should just like named_properties_[name] = desc
   ASSERT(GetOwnProperty(O, name).IsUndefined());
-  PropertyMap::Set(Handle<PropertyMap>(O.val()->named_properties()), name, desc);
+  PropertyMap::Set(O, name, desc);
 }
 
 }  // namespace es
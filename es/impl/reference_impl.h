@@ -16,55 +16,60 @@ Handle<JSValue> GetValue(Handle<Error>& e, Handle<JSValue> V) {
   TEST_LOG("GetValue: " + base.ToString() + "." + name.ToString());
 
   if (Reference::IsUnresolvableReference(base)) {
-    e = Error::ReferenceError(name.val()->data() + u" is not defined");
+    e = Error::ReferenceError(u"", name, u" is not defined");
     return Handle<JSValue>();
   }
   if (Reference::IsPropertyReference(base)) {  // 4
-    // 4.a & 4.b
-    if (base.val()->IsObject()) {
-      Handle<JSObject> obj = static_cast<Handle<JSObject>>(base);
-      return Get(e, obj, name);
-    } else {  // special [[Get]]
-      Handle<JSObject> O;
-      if (base.val()->IsString()) {
-        Handle<String> s = base;
-        size_t length = s.val()->size();
-        if (name.val()->IsArrayIndex()) {
-          size_t index = name.val()->Index();
-          if (index < length) {
-            return String::Substr(s, index, 1);
-          } else {
-            return Undefined::Instance();
-          }
-        } else if (StringEqual(name, String::Length())) {
-          return Number::New(length);
+    return GetValueProperty(e, base, name);
+  } else {
+    ASSERT(base.val()->IsEnvironmentRecord());
+    bool is_strict = Runtime::TopContext().strict();
+    Handle<EnvironmentRecord> er = static_cast<Handle<EnvironmentRecord>>(base);
+    return GetBindingValue(e, er, name, is_strict);
+  }
+}
+
+// 8.7.1 GetValue (V) step 4, for the property name of base.
+Handle<JSValue> GetValueProperty(Handle<Error>& e, Handle<JSValue> base, Handle<String> name) {
+  // 4.a & 4.b
+  if (base.val()->IsObject()) {
+    Handle<JSObject> obj = static_cast<Handle<JSObject>>(base);
+    return Get(e, obj, name);
+  } else {  // special [[Get]]
+    Handle<JSObject> O;
+    if (base.val()->IsString()) {
+      Handle<String> s = base;
+      size_t length = s.val()->size();
+      if (name.val()->IsArrayIndex()) {
+        size_t index = name.val()->Index();
+        if (index < length) {
+          return String::Substr(s, index, 1);
         } else {
-          O = StringProto::Instance();
+          return Undefined::Instance();
         }
+      } else if (StringEqual(name, String::Length())) {
+        return Number::New(length);
       } else {
-        O = ToObject(e, base);
+        O = StringProto::Instance();
       }
-      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-      StackPropertyDescriptor desc = GetProperty(O, name);
-      if (desc.IsUndefined())
+    } else {
+      O = ToObject(e, base);
+    }
+    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    StackPropertyDescriptor desc = GetProperty(O, name);
+    if (desc.IsUndefined())
+      return Undefined::Instance();
+    if (desc.IsDataDescriptor()) {
+      return desc.Value();
+    } else {
+      ASSERT(desc.IsAccessorDescriptor());
+      Handle<JSValue> getter = desc.Get();
+      if (getter.val()->IsUndefined()) {
         return Undefined::Instance();
-      if (desc.IsDataDescriptor()) {
-        return desc.Value();
-      } else {
-        ASSERT(desc.IsAccessorDescriptor());
-        Handle<JSValue> getter = desc.Get();
-        if (getter.val()->IsUndefined()) {
-          return Undefined::Instance();
-        }
-        Handle<JSObject> getter_obj = static_cast<Handle<JSObject>>(getter);
-        return Call(e, getter_obj, base, {});
       }
+      Handle<JSObject> getter_obj = static_cast<Handle<JSObject>>(getter);
+      return Call(e, getter_obj, base, {});
     }
-  } else {
-    ASSERT(base.val()->IsEnvironmentRecord());
-    bool is_strict = Runtime::TopContext().strict();
-    Handle<EnvironmentRecord> er = static_cast<Handle<EnvironmentRecord>>(base);
-    return GetBindingValue(e, er, name, is_strict);
   }
 }
 
@@ -82,7 +87,7 @@ void PutValue(Handle<Error>& e, Handle<JSValue> V, Handle<JSValue> W) {
 
   if (Reference::IsUnresolvableReference(base)) {  // 3
     if (is_strict) {  // 3.a
-      e = Error::ReferenceError(name.val()->data() + u" is not defined");
+      e = Error::ReferenceError(u"", name, u" is not defined");
       return;
     }
     Put(e, GlobalObject::Instance(), name, W, false);  // 3.b
@@ -129,7 +134,7 @@ void PutValue(Handle<Error>& e, Handle<JSValue> V, Handle<JSValue> W) {
 
 Handle<JSValue> GetValueEnvRec(Handle<Error>& e, Handle<JSValue> base, Handle<String> name, bool strict) {
   if (base.val()->IsUndefined()) {
-    e = Error::ReferenceError(name.val()->data() + u" is not defined");
+    e = Error::ReferenceError(u"", name, u" is not defined");
     return Handle<JSValue>();
   } else {
     ASSERT(base.val()->IsEnvironmentRecord());
@@ -141,7 +146,7 @@ Handle<JSValue> GetValueEnvRec(Handle<Error>& e, Handle<JSValue> base, Handle<St
 void PutValueEnvRec(Handle<Error>& e, Handle<JSValue> base, Handle<String> name, bool strict, Handle<JSValue> value) {
   if (base.val()->IsUndefined()) {  // 3
     if (strict) {  // 3.a
-      e = Error::ReferenceError(name.val()->data() + u" is not defined");
+      e = Error::ReferenceError(u"", name, u" is not defined");
       return;
     }
     Put(e, GlobalObject::Instance(), name, value, false);  // 3.b
@@ -10,9 +10,33 @@
 #include <es/parser/token.h>
 #include <es/utils/macros.h>
 #include <es/types/base.h>
+#include <es/utils/property_map.h>
 
 namespace es {
 
+// The labels are interned as small ids when parsed, so that a Completion
+// carries and compares its target as an integer.
+constexpr uint32_t kEmptyLabel = 0;
+
+class LabelTable {
+ public:
+  static uint32_t Intern(const std::u16string& label) {
+    if (label.empty())
+      return kEmptyLabel;
+    auto iter = ids_.find(label);
+    if (iter != ids_.end())
+      return iter->second;
+    uint32_t id = ids_.size() + 1;
+    ids_.emplace(label, id);
+    return id;
+  }
+
+ private:
+  static std::unordered_map<std::u16string, uint32_t> ids_;
+};
+
+std::unordered_map<std::u16string, uint32_t> LabelTable::ids_;
+
 class AST {
  public:
   enum Type {
@@ -80,13 +104,14 @@ class AST {
         jsval_ = String::New<GCFlag::CONST>(source);
         break;
       case AST::AST_EXPR_BOOL:
-        jsval_ = Bool::Wrap(source == u"true");
+        jsval_ = Handle<JSValue>::Constant(Bool::Wrap(source == u"true").val());
         break;
       case AST::AST_EXPR_STRING:
         jsval_ = String::Eval<GCFlag::CONST>(source);
         break;
       case AST::AST_EXPR_NUMBER:
-        jsval_ = Number::Eval<GCFlag::CONST>(source);
+        // Small numbers are on stack and need a constant slot as well.
+        jsval_ = Handle<JSValue>::Constant(Number::Eval<GCFlag::CONST>(source).val());
         break;
       default:
         jsval_ = Handle<JSValue>();
@@ -109,18 +134,41 @@ class AST {
 
   bool IsIllegal() { return type_ == AST_ILLEGAL; }
 
-  const std::u16string& label() { return label_; }
-  void SetLabel(std::u16string label) { label_ = label; }
+  uint32_t label() { return label_; }
+  void SetLabel(uint32_t label) { label_ = label; }
 
  private:
   Type type_;
   std::u16string source_;
   size_t start_;
   size_t end_;
-  std::u16string label_;
+  uint32_t label_ = kEmptyLabel;
   Handle<JSValue> jsval_;
 };
 
+// An identifier that resolves to a data property of the global object
+// keeps where the value is, which is valid as long as the epoch of the
+// global cells is unchanged, see GlobalCells.
+class Identifier : public AST {
+ public:
+  Identifier(Type type, std::u16string source, size_t start, size_t end) :
+    AST(type, source, start, end), cell_(nullptr), writable_(false), epoch_(0) {}
+
+  // nullptr if the cell is not cached in `epoch`.
+  JSValue** cell(uint64_t epoch) { return epoch_ == epoch ? cell_ : nullptr; }
+  bool writable() { return writable_; }
+  void SetCell(JSValue** cell, bool writable, uint64_t epoch) {
+    cell_ = cell;
+    writable_ = writable;
+    epoch_ = epoch;
+  }
+
+ private:
+  JSValue** cell_;
+  bool writable_;
+  uint64_t epoch_;
+};
+
 class RegExpLiteral : public AST {
  public:
   RegExpLiteral(std::u16string pattern, std::u16string flag,
@@ -148,6 +196,14 @@ class ArrayLiteral : public AST {
   size_t length() { return len_; }
   const std::vector<std::pair<size_t, AST*>>& elements() { return elements_; }
 
+  // The element slots of a fresh array, see ArrayBoilerplate.
+  bool has_boilerplate() { return has_boilerplate_; }
+  const std::vector<PropertyMap::Slot>& boilerplate() { return boilerplate_; }
+  void SetBoilerplate(std::vector<PropertyMap::Slot> boilerplate) {
+    boilerplate_ = std::move(boilerplate);
+    has_boilerplate_ = true;
+  }
+
   void AddElement(AST* element) {
     if (element != nullptr) {
       elements_.emplace_back(len_, element);
@@ -158,6 +214,8 @@ class ArrayLiteral : public AST {
  private:
   std::vector<std::pair<size_t, AST*>> elements_;
   size_t len_;
+  bool has_boilerplate_ = false;
+  std::vector<PropertyMap::Slot> boilerplate_;
 };
 
 Handle<String> NumberToStringConst(double m);
@@ -191,6 +249,14 @@ class ObjectLiteral : public AST {
     properties_.emplace_back(p);
   }
 
+  // The named properties of a fresh object, see ObjectBoilerplate.
+  bool has_boilerplate() { return has_boilerplate_; }
+  HashMapV2* boilerplate() { return boilerplate_; }
+  void SetBoilerplate(HashMapV2* boilerplate) {
+    boilerplate_ = boilerplate;
+    has_boilerplate_ = true;
+  }
+
   static Handle<String> EvalPropertyName(Token token) {
     switch (token.type()) {
       case Token::TK_STRICT_FUTURE:
@@ -222,6 +288,9 @@ class ObjectLiteral : public AST {
 
  private:
   std::vector<Property> properties_;
+  bool has_boilerplate_ = false;
+  // Constant, nullptr when the literal can not use one.
+  HashMapV2* boilerplate_ = nullptr;
 };
 
 class Paren : public AST {
@@ -314,7 +383,7 @@ class Expression : public AST {
 
 class Arguments : public AST {
  public:
-  Arguments(std::vector<AST*> args) : AST(AST_EXPR_ARGS), args_(args) {}
+  Arguments(std::vector<AST*> args) : AST(AST_EXPR_ARGS), args_(args), may_call_eval_(true) {}
 
   ~Arguments() override {
     for (auto arg : args_)
@@ -323,8 +392,15 @@ class Arguments : public AST {
 
   const std::vector<AST*>& args() { return args_; }
 
+  // Whether the callee of this call site may be referred by the name
+  // "eval", see LHS::AddArguments. If not, the call can not be a direct
+  // call to eval (15.1.2.1.1) and the name need not be checked at runtime.
+  bool may_call_eval() { return may_call_eval_; }
+  void set_may_call_eval(bool b) { may_call_eval_ = b; }
+
  private:
   std::vector<AST*> args_;
+  bool may_call_eval_;
 };
 
 class LHS : public AST {
@@ -346,6 +422,14 @@ class LHS : public AST {
   };
 
   void AddArguments(Arguments* args) {
+    // Only the name of a computed property is unknown before running.
+    if (order_.empty()) {
+      args->set_may_call_eval(
+        (base_->type() != AST_EXPR_IDENT && base_->type() != AST_EXPR_STRICT_FUTURE) ||
+        base_->source() == u"eval");
+    } else if (order_.back().second == PROP) {
+      args->set_may_call_eval(StringEqual(prop_name_list_.back(), String::eval()));
+    }
     order_.emplace_back(std::make_pair(args_list_.size(), CALL));
     args_list_.emplace_back(args);
     total_count_++;
@@ -419,6 +503,8 @@ class ProgramOrFunctionBody : public AST {
       delete func_decl;
     for (auto stmt : stmts_)
       delete stmt;
+    if (env_recs_.registered)
+      ExtracGC::UnregisterFunctionEnvRecs(&env_recs_);
   }
 
   void AddFunctionDecl(AST* func) {
@@ -457,6 +543,22 @@ class ProgramOrFunctionBody : public AST {
   size_t num_this_properties() { return num_this_properties_; }
   void SetNumThisProperties(size_t num) { num_this_properties_ = num; }
 
+  // The bindings of a call in the order of 10.5: the parameters, the
+  // function declarations, `arguments` and the variables, each name once.
+  void SetBindingLayout(const std::vector<Handle<String>>& params);
+  const std::vector<Handle<String>>& binding_names() { return binding_names_; }
+  // The index in binding_names() of each parameter and function declaration.
+  const std::vector<uint32_t>& param_bindings() { return param_bindings_; }
+  const std::vector<uint32_t>& func_decl_bindings() { return func_decl_bindings_; }
+  // -1 when there is no arguments object.
+  int32_t arguments_binding() { return arguments_binding_; }
+
+  // The bindings of a fresh call, see InstantiateBindingTemplate.
+  HashMapV2* binding_template() { return binding_template_; }
+  void SetBindingTemplate(HashMapV2* binding_template) { binding_template_ = binding_template; }
+
+  ExtracGC::FunctionEnvRecFreeList* env_recs() { return &env_recs_; }
+
  private:
   bool strict_;
   bool use_arguments_ = true;
@@ -465,7 +567,14 @@ class ProgramOrFunctionBody : public AST {
 
   std::vector<VarDecl*> var_decls_;
   // this may not be accurate
-  size_t num_this_properties_;
+  size_t num_this_properties_ = 0;
+
+  std::vector<Handle<String>> binding_names_;
+  std::vector<uint32_t> param_bindings_;
+  std::vector<uint32_t> func_decl_bindings_;
+  int32_t arguments_binding_ = -1;
+  HashMapV2* binding_template_ = nullptr;
+  ExtracGC::FunctionEnvRecFreeList env_recs_;
 };
 
 Function::Function(Handle<String> name, std::vector<Handle<String>> params, AST* body,
@@ -488,6 +597,7 @@ Function::Function(Handle<String> name, std::vector<Handle<String>> params, AST*
       }
     }
   }
+  body_->SetBindingLayout(params);
 }
 
 Function::~Function() {
@@ -499,16 +609,18 @@ size_t Function::num_decls() { return params_.size() + body_->num_decls(); }
 class LabelledStmt : public AST {
  public:
   LabelledStmt(Token label, AST* stmt, std::u16string source, size_t start, size_t end) :
-    AST(AST_STMT_LABEL, source, start, end), label_(label.source()), stmt_(stmt) {}
+    AST(AST_STMT_LABEL, source, start, end), label_(LabelTable::Intern(label.source())), stmt_(stmt) {
+    stmt_->SetLabel(label_);
+  }
   ~LabelledStmt() {
     delete stmt_;
   }
 
-  const std::u16string& label() { return label_; }
+  uint32_t label() { return label_; }
   AST* statement() { return stmt_; }
 
  private:
-  std::u16string label_;
+  uint32_t label_;
   AST* stmt_;
 };
 
@@ -518,12 +630,12 @@ class ContinueOrBreak : public AST {
     ContinueOrBreak(type, Token(Token::TK_NOT_FOUND, u"", 0, 0), source, start, end) {}
 
   ContinueOrBreak(Type type, Token ident, std::u16string source, size_t start, size_t end) :
-    AST(type, source, start, end), ident_(ident) {}
+    AST(type, source, start, end), target_(LabelTable::Intern(ident.source())) {}
 
-  std::u16string ident() { return ident_.source(); }
+  uint32_t target() { return target_; }
 
  private:
-  Token ident_;
+  uint32_t target_;
 };
 
 class Return : public AST {
@@ -580,6 +692,26 @@ class VarDecl : public AST {
   AST* init_;
 };
 
+void ProgramOrFunctionBody::SetBindingLayout(const std::vector<Handle<String>>& params) {
+  std::unordered_map<String*, uint32_t, StringHasher, StringEqualer> indices;
+  auto binding = [&](Handle<String> name) {
+    auto iter = indices.emplace(name.val(), binding_names_.size());
+    if (iter.second)
+      binding_names_.emplace_back(name);
+    return iter.first->second;
+  };
+  for (Handle<String> param : params)
+    param_bindings_.emplace_back(binding(param));
+  for (Function* func_decl : func_decls_)
+    func_decl_bindings_.emplace_back(binding(func_decl->name()));
+  // 10.5 step 7, a parameter or function named arguments shadows the
+  // arguments object, but a variable does not.
+  if (use_arguments_ && indices.find(String::arguments().val()) == indices.end())
+    arguments_binding_ = binding(String::arguments());
+  for (VarDecl* decl : var_decls_)
+    binding(decl->ident());
+}
+
 class VarStmt : public AST {
  public:
   VarStmt() : AST(AST_STMT_VAR) {}
@@ -735,6 +867,7 @@ class Switch : public AST {
     for (auto stmt : default_clause_.stmts) {
       delete  stmt;
     }
+    delete jump_table_;
   }
 
   void SetExpr(AST* expr) {
@@ -768,15 +901,75 @@ class Switch : public AST {
   AST* expr() { return expr_; }
   const std::vector<CaseClause>& before_default_case_clauses() { return before_default_case_clauses_; }
   bool has_default_clause() { return has_default_clause_; }
-  DefaultClause default_clause() {
+  const DefaultClause& default_clause() {
     ASSERT(has_default_clause());
     return default_clause_;
   }
   const std::vector<CaseClause>& after_default_case_clauses() { return after_default_case_clauses_; }
+  size_t num_case_clauses() {
+    return before_default_case_clauses_.size() + after_default_case_clauses_.size();
+  }
+  // The i-th case clause, counting the ones before default first.
+  const CaseClause& case_clause(size_t i) {
+    if (i < before_default_case_clauses_.size())
+      return before_default_case_clauses_[i];
+    return after_default_case_clauses_[i - before_default_case_clauses_.size()];
+  }
+
+  // When every case is a number or string literal, the matching clause is
+  // found by a lookup instead of comparing with the cases one by one. The
+  // value is the index of case_clause, and the first one wins for
+  // duplicated cases.
+  struct JumpTable {
+    std::unordered_map<double, size_t> numbers;
+    std::unordered_map<String*, size_t, StringHasher, StringEqualer> strings;
+
+    // `not_found` if no case matches, which is always the case for NaN.
+    size_t Find(JSValue* input, size_t not_found) {
+      if (input->IsNumber()) {
+        auto iter = numbers.find(static_cast<Number*>(input)->data());
+        return iter == numbers.end() ? not_found : iter->second;
+      }
+      if (input->IsString()) {
+        auto iter = strings.find(static_cast<String*>(input));
+        return iter == strings.end() ? not_found : iter->second;
+      }
+      return not_found;
+    }
+  };
+
+  // Built on the first evaluation, nullptr if some case is not a literal.
+  JumpTable* jump_table() {
+    if (!jump_table_built_) {
+      jump_table_built_ = true;
+      jump_table_ = BuildJumpTable();
+    }
+    return jump_table_;
+  }
 
  private:
+  JumpTable* BuildJumpTable() {
+    JumpTable* table = new JumpTable();
+    for (size_t i = 0; i < num_case_clauses(); ++i) {
+      AST* expr = case_clause(i).expr;
+      while (expr->type() == AST_EXPR_LHS && static_cast<LHS*>(expr)->total_count() == 0)
+        expr = static_cast<LHS*>(expr)->base();
+      if (expr->type() == AST_EXPR_NUMBER) {
+        table->numbers.emplace(static_cast<Number*>(expr->jsval().val())->data(), i);
+      } else if (expr->type() == AST_EXPR_STRING && expr->jsval().val()->IsString()) {
+        table->strings.emplace(static_cast<String*>(expr->jsval().val()), i);
+      } else {
+        delete table;
+        return nullptr;
+      }
+    }
+    return table;
+  }
+
   AST* expr_;
   bool has_default_clause_ = false;
+  bool jump_table_built_ = false;
+  JumpTable* jump_table_ = nullptr;
   DefaultClause default_clause_;
   std::vector<CaseClause> before_default_case_clauses_;
   std::vector<CaseClause> after_default_case_clauses_;
@@ -28,10 +28,10 @@ class Parser {
         return new AST(AST::AST_EXPR_THIS, TOKEN_SOURCE);
       case Token::TK_STRICT_FUTURE:
         lexer_.Next();
-        return new AST(AST::AST_EXPR_STRICT_FUTURE, TOKEN_SOURCE);
+        return new Identifier(AST::AST_EXPR_STRICT_FUTURE, TOKEN_SOURCE);
       case Token::TK_IDENT:
         lexer_.Next();
-        return new AST(AST::AST_EXPR_IDENT, TOKEN_SOURCE);
+        return new Identifier(AST::AST_EXPR_IDENT, TOKEN_SOURCE);
       case Token::TK_NULL:
         lexer_.Next();
         return new AST(AST::AST_EXPR_NULL, TOKEN_SOURCE);
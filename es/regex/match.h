@@ -2,6 +2,7 @@
 #define ES_REGEX_MATCH
 
 #include <es/utils/helper.h>
+#include <es/types/base.h>
 
 namespace es {
 namespace regex {
@@ -22,11 +23,9 @@ struct MatchResult {
   State state;
 };
 
-MatchResult SplitMatch(std::u16string S, size_t q, std::u16string R) {
-  size_t r = R.size();
-  size_t s = S.size();
-  if (r + q > s) return MatchResult::Failed();
-  if (S.substr(q, r) != R)
+MatchResult SplitMatch(Handle<String> S, size_t q, Handle<String> R) {
+  size_t r = R.val()->size();
+  if (!StringMatchAt(S.val(), q, R.val()))
     return MatchResult::Failed();
   std::vector<std::u16string> cap;
   return MatchResult(false, {q+r, cap});
@@ -46,19 +46,19 @@ class ExecutionContext {
     lexical_env_ = lexical_env;
   }
 
-  bool HasLabel(std::u16string label) {
-    if (label == u"")
+  bool HasLabel(uint32_t label) {
+    if (label == kEmptyLabel)
       return true;
     return label_stack_.size() && label_stack_.top() == label;
   }
 
-  void AddLabel(std::u16string label) {
+  void AddLabel(uint32_t label) {
     ASSERT(!HasLabel(label));
     label_stack_.push(label);
   }
 
-  void RemoveLabel(std::u16string label) {
-    if (label == u"") return;
+  void RemoveLabel(uint32_t label) {
+    if (label == kEmptyLabel) return;
     ASSERT(HasLabel(label));
     label_stack_.pop();
   }
@@ -98,7 +98,7 @@ class ExecutionContext {
   Handle<JSValue> this_binding_;
 
   bool strict_;
-  std::stack<std::u16string> label_stack_;
+  std::stack<uint32_t> label_stack_;
   size_t iteration_layers_;
   size_t switch_layers_;
 
@@ -137,18 +137,6 @@ class Runtime {
     context_stack_.pop_back();
   }
 
-  static Handle<JSValue> TopValue() {
-    return Runtime::Global()->value_stack_.back();
-  }
-
-  void AddValue(Handle<JSValue> val) {
-    value_stack_.emplace_back(val);
-  }
-
-  void PopValue() {
-    value_stack_.pop_back();
-  }
-
   std::u16string AddSource(std::u16string&& source) {
     sources_.emplace_back(source);
     return sources_[sources_.size() - 1];
@@ -187,36 +175,48 @@ class Runtime {
   }
 
  private:
-  Runtime() {
-    value_stack_.emplace_back(Null::Instance());
-  }
+  Runtime() {}
 
   std::vector<ExecutionContext> context_stack_;
-  // This is to make sure builtin function like `array.push()`
-  // can visit `array`.
-  std::vector<Handle<JSValue>> value_stack_;
   std::vector<std::u16string> sources_;
 };
 
-class ValueGuard {
+// The arguments of the calls in progress are kept on one contiguous stack,
+// and a call reads its window of the stack as a span, so that passing the
+// arguments allocates nothing. The windows are closed in the reverse order
+// of opening, and only the top one could be added to.
+class ArgumentWindow {
  public:
-  ValueGuard() : count_(0) {}
-  ~ValueGuard() {
-    while (count_ > 0) {
-      Runtime::Global()->PopValue();
-      count_--;
+  ArgumentWindow() : start_(top_) {}
+  ~ArgumentWindow() { top_ = start_; }
+
+  void Add(Handle<JSValue> val) {
+    if (unlikely(top_ == kMaxNumArguments)) {
+      throw std::runtime_error("too many arguments");
     }
+    stack_[top_++] = val;
+  }
+
+  void Add(Span<Handle<JSValue>> vals) {
+    for (Handle<JSValue> val : vals)
+      Add(val);
   }
 
-  void AddValue(Handle<JSValue> val) {
-    Runtime::Global()->AddValue(val);
-    count_++;
+  Span<Handle<JSValue>> span() {
+    return Span<Handle<JSValue>>(stack_ + start_, top_ - start_);
   }
 
  private:
-  size_t count_;
+  static constexpr size_t kMaxNumArguments = 1024 * 1024;
+  static Handle<JSValue> stack_[kMaxNumArguments];
+  static size_t top_;
+
+  size_t start_;
 };
 
+Handle<JSValue> ArgumentWindow::stack_[ArgumentWindow::kMaxNumArguments];
+size_t ArgumentWindow::top_ = 0;
+
 }  // namespace es
 
 #endif  // ES_EXECUTION_CONTEXT_H
\ No newline at end of file
@@ -8,6 +8,9 @@
 #include <unordered_map>
 
 #include <es/gc/heap_object.h>
+#include <es/utils/double_conversion.h>
+#include <es/utils/hash.h>
+#include <es/utils/simd.h>
 
 namespace es {
 
@@ -54,7 +57,7 @@ class JSValue {
   inline bool IsLanguageType() { return type() < SPEC_TYPE && type() != JS_REF; }
 
   inline bool IsReference() { return type() == JS_REF; }
-  inline bool IsPropertyDescriptor() { return type() == JS_PROP_DESC; }
+  inline bool IsAccessorPair() { return type() == JS_ACCESSOR_PAIR; }
   inline bool IsEnvironmentRecord() { return type() == JS_ENV_REC_DECL || type() == JS_ENV_REC_OBJ; }
 
   inline bool IsGetterSetter() { return type() == JS_GET_SET; }
@@ -115,31 +118,24 @@ std::u16string ArrayIndexToString(uint32_t index);
 class String : public JSValue {
  public:
   template<flag_t flag = 0>
-  static Handle<String> New(const std::u16string& data) {
-    size_t n = data.size();
+  static Handle<String> New(const char16_t* data, size_t n) {
     double index;
-    if (unlikely(ToArrayIndex(data.c_str(), n, index))) {
+    if (unlikely(ToArrayIndex(data, n, index))) {
       return String::New(index, n);
     }
+    if (n == 1 && data[0] < kNumSingleCharStrings) {
+      return String::SingleChar(data[0]);
+    }
     Handle<String> str = String::Alloc<flag>(n);
 
-    memcpy(PTR(str.val(), kStringDataOffset), data.data(), n * kChar16Size);
+    memcpy(PTR(str.val(), kStringDataOffset), data, n * kChar16Size);
 
     return str;
   }
 
   template<flag_t flag = 0>
-  static Handle<String> New(std::u16string&& data) {
-    size_t n = data.size();
-    double index;
-    if (unlikely(ToArrayIndex(data.c_str(), n, index))) {
-      return String::New(index, n);
-    }
-    Handle<String> str = String::Alloc<flag>(n);
-
-    memcpy(PTR(str.val(), kStringDataOffset), data.data(), n * kChar16Size);
-
-    return str;
+  static Handle<String> New(const std::u16string& data) {
+    return String::New<flag>(data.data(), data.size());
   }
 
   static Handle<String> New(uint32_t index) {
@@ -162,44 +158,46 @@ class String : public JSValue {
       return ArrayIndexToString(Index());
     return std::u16string(c_str(), size());
   }
-  size_t length_slot() {
-    ASSERT(!IsArrayIndex());
-    return READ_VALUE(this, kLengthOffset, size_t);
-  }
   size_t size() {
     if (IsArrayIndex()) {
       return (reinterpret_cast<uint64_t>(this) >> STACK_SHIFT) & 31;
     }
-    size_t slot = length_slot();
-    switch (type()) {
-      case JS_STRING:
-        return slot >> 16;
-      case JS_LONG_STRING:
-        return slot >> 1;
-      default:
-        assert(false);
-    }
+    return READ_VALUE(this, kLengthOffset, uint32_t);
   }
-  size_t Hash() {
+  uint32_t Hash() {
     if (IsArrayIndex())
       return Index();
-    size_t slot = length_slot();
-    if (slot & 1) return slot >> 1;
-    size_t hash = U16Hash(data());
-    hash = hash << 1 | 1;
-    hash = slot | (0x0000FFFF & hash);
-    SET_VALUE(this, kLengthOffset, hash, size_t);
-    return hash >> 1;
+    uint32_t hash = READ_VALUE(this, kHashOffset, uint32_t);
+    if (likely(hash))
+      return hash;
+    hash = hash::U16Hash(c_str(), size());
+    SET_VALUE(this, kHashOffset, hash, uint32_t);
+    return hash;
   }
 
-  bool HasHash() { return IsArrayIndex() || (length_slot() & 1); }
+  bool HasHash() { return IsArrayIndex() || READ_VALUE(this, kHashOffset, uint32_t) != 0; }
+
+  char16_t* c_str() {
+    ASSERT(!IsArrayIndex());
+    if (unlikely(IsSliced()))
+      return parent()->c_str() + READ_VALUE(this, kSliceStartOffset, size_t);
+    return TYPED_PTR(this, kStringDataOffset, char16_t);
+  }
+
+  // A sliced string shares the storage of its parent, which is never a
+  // sliced string itself.
+  bool IsSliced() { return !IsArrayIndex() && (bitmask() & kSlicedMask); }
+  String* parent() {
+    ASSERT(IsSliced());
+    return READ_VALUE(this, kParentOffset, String*);
+  }
 
   char16_t get(size_t index) {
     ASSERT(index < size());
     if (IsArrayIndex()) {
       uint32_t remains = size() - index - 1;
       uint32_t index = Index();
-      while (remains) {
+      while (remains--) {
         index /= 10;
       }
       return u'0' + index % 10;
@@ -210,13 +208,21 @@ class String : public JSValue {
   static Handle<String> Substr(Handle<String> str, size_t pos, size_t len) {
     ASSERT(pos + len <= str.val()->size());
     if (str.val()->IsArrayIndex()) {
-      std::cout << "not implemented yet" << std::endl;
-      assert(false);
+      return String::New(str.val()->data().substr(pos, len));
+    }
+    if (pos == 0 && len == str.val()->size()) {
+      return str;
     }
     double index;
     if (ToArrayIndex(str.val()->c_str() + pos, len, index)) {
       return String::New(index, len);
     }
+    if (len == 1 && str.val()->c_str()[pos] < kNumSingleCharStrings) {
+      return String::SingleChar(str.val()->c_str()[pos]);
+    }
+    if (len >= kMinSlicedLength) {
+      return Slice(str, pos, len);
+    }
     Handle<String> substring = String::Alloc(len);
     memcpy(substring.val()->c_str(),
            str.val()->c_str() + pos,
@@ -280,6 +286,18 @@ class String : public JSValue {
   template <flag_t flag>
   static Handle<JSValue> Eval(const std::u16string& source);
 
+  // Strings of a single ascii char are preallocated.
+  static Handle<String> SingleChar(char16_t c) {
+    ASSERT(c < kNumSingleCharStrings);
+    static String* singletons[kNumSingleCharStrings] = {};
+    if (unlikely(singletons[c] == nullptr)) {
+      Handle<String> str = String::Alloc<GCFlag::CONST>(1);
+      str.val()->c_str()[0] = c;
+      singletons[c] = str.val();
+    }
+    return Handle<String>(singletons[c]);
+  }
+
   static Handle<String> Empty() {
     static Handle<String> singleton = String::New<GCFlag::CONST>(u"");
     return singleton;
@@ -432,16 +450,28 @@ class String : public JSValue {
  private:
   template<flag_t flag = 0>
   static Handle<String> Alloc(size_t n) {
-    Handle<JSValue> jsval = HeapObject::New<flag>(kSizeTSize + n * kChar16Size);
-
-    if (n < kLongStringSize) {
-      // The last digit is for decide whether hash is calculated.
-      SET_VALUE(jsval.val(), kLengthOffset, n << 16, size_t);
-      jsval.val()->SetType(JS_STRING);
-    } else {
-      SET_VALUE(jsval.val(), kLengthOffset, n << 1, size_t);
-      jsval.val()->SetType(JS_LONG_STRING);
+    Handle<JSValue> jsval = HeapObject::New<flag>(2 * kUint32Size + n * kChar16Size);
+
+    SET_VALUE(jsval.val(), kLengthOffset, n, uint32_t);
+    // 0 means the hash is not calculated yet.
+    SET_VALUE(jsval.val(), kHashOffset, 0, uint32_t);
+    jsval.val()->SetType(n < kLongStringSize ? JS_STRING : JS_LONG_STRING);
+    return Handle<String>(jsval);
+  }
+
+  static Handle<String> Slice(Handle<String> str, size_t pos, size_t len) {
+    if (str.val()->IsSliced()) {
+      pos += READ_VALUE(str.val(), kSliceStartOffset, size_t);
+      str = Handle<String>(str.val()->parent());
     }
+    Handle<JSValue> jsval = HeapObject::New(2 * kUint32Size + kPtrSize + kSizeTSize);
+
+    SET_VALUE(jsval.val(), kLengthOffset, len, uint32_t);
+    SET_VALUE(jsval.val(), kHashOffset, 0, uint32_t);
+    SET_HANDLE_VALUE(jsval.val(), kParentOffset, str, String);
+    SET_VALUE(jsval.val(), kSliceStartOffset, pos, size_t);
+    jsval.val()->SetType(JS_STRING);
+    jsval.val()->SetBitMask(kSlicedMask);
     return Handle<String>(jsval);
   }
 
@@ -452,17 +482,20 @@ class String : public JSValue {
       JS_STRING));
   }
 
-  char16_t* c_str() {
-    ASSERT(!IsArrayIndex());
-    return TYPED_PTR(this, kStringDataOffset, char16_t);
-  }
-
-  static constexpr size_t kLengthOffset = kJSValueOffset;
-  static constexpr size_t kStringDataOffset = kLengthOffset + kSizeTSize;
-
   static constexpr size_t kLongStringSize = 65536;
+  // Shorter substrings are copied, as a slice is not smaller than them
+  // and would keep the whole parent alive.
+  static constexpr size_t kMinSlicedLength = 13;
+  static constexpr uint8_t kSlicedMask = 1;
+  static constexpr char16_t kNumSingleCharStrings = 128;
 
-  static constexpr std::hash<std::u16string> U16Hash = std::hash<std::u16string>{};
+ public:
+  static constexpr size_t kLengthOffset = kJSValueOffset;
+  static constexpr size_t kHashOffset = kLengthOffset + kUint32Size;
+  static constexpr size_t kStringDataOffset = kHashOffset + kUint32Size;
+  // Layout of sliced string.
+  static constexpr size_t kParentOffset = kStringDataOffset;
+  static constexpr size_t kSliceStartOffset = kParentOffset + kPtrSize;
 };
 
 inline bool StringEqual(String* a, String* b) {
@@ -471,24 +504,28 @@ inline bool StringEqual(String* a, String* b) {
   if (a->IsArrayIndex() && b->IsArrayIndex())
     return a->Index() == b->Index();
   if (a->HasHash() && b->HasHash()) {
-    if (a->length_slot() != b->length_slot())
+    if (a->Hash() != b->Hash())
       return false;
   }
   if (a->size() != b->size()) {
     return false;
   }
-  size_t size = a->size();
-  for (size_t i = 0; i < size; i++) {
-    if (a->get(i) != b->get(i))
-      return false;
-  }
-  return true;
+  return simd::Equal(a->c_str(), b->c_str(), a->size());
 }
 
 inline bool StringEqual(Handle<String> a, Handle<String> b) {
   return StringEqual(a.val(), b.val());
 }
 
+// For std containers of String*, compare by content.
+struct StringHasher {
+  size_t operator()(String* s) const { return s->Hash(); }
+};
+
+struct StringEqualer {
+  bool operator()(String* a, String* b) const { return StringEqual(a, b); }
+};
+
 inline bool StringLessThan(String* a, String* b) {
   if (a->IsArrayIndex() && b->IsArrayIndex()) {
     return a->Index() < b->Index();
@@ -496,15 +533,35 @@ inline bool StringLessThan(String* a, String* b) {
   if (a->IsArrayIndex() || b->IsArrayIndex()) {
     return a->data() < b->data();
   }
-  size_t size_a = a->size();
-  size_t size_b = b->size();
-  size_t size = size_a < size_b ? size_a : size_b;
+  return simd::Compare(a->c_str(), a->size(), b->c_str(), b->size()) < 0;
+}
 
-  for (size_t i = 0; i < size; i++) {
-    if (a->get(i) != b->get(i))
-      return a->get(i) < b->get(i);
+// Whether b occurs in a at pos.
+inline bool StringMatchAt(String* a, size_t pos, String* b) {
+  size_t n = b->size();
+  if (pos + n > a->size())
+    return false;
+  if (a->IsArrayIndex() || b->IsArrayIndex())
+    return a->data().compare(pos, n, b->data()) == 0;
+  return simd::Equal(a->c_str() + pos, b->c_str(), n);
+}
+
+// Index of the first occurrence of b in a at or after pos, or simd::npos.
+inline size_t StringFind(String* a, String* b, size_t pos) {
+  if (a->IsArrayIndex() || b->IsArrayIndex()) {
+    size_t res = a->data().find(b->data(), pos);
+    return res == std::u16string::npos ? simd::npos : res;
+  }
+  return simd::Find(a->c_str(), a->size(), b->c_str(), b->size(), pos);
+}
+
+// Index of the last occurrence of b in a at or before pos, or simd::npos.
+inline size_t StringRFind(String* a, String* b, size_t pos) {
+  if (a->IsArrayIndex() || b->IsArrayIndex()) {
+    size_t res = a->data().rfind(b->data(), pos);
+    return res == std::u16string::npos ? simd::npos : res;
   }
-  return size_a < size_b;
+  return simd::RFind(a->c_str(), a->size(), b->c_str(), b->size(), pos);
 }
 
 bool HaveDuplicate(std::vector<Handle<String>> vals) {
@@ -10,12 +10,21 @@
 namespace es {
 
 // 10.6 Arguments Object
+// The mapped indices read and write the bindings of the parameters in the
+// env of the call, which takes the place of the [[ParameterMap]]. The own
+// data properties of the mapped indices are still kept, as the keys and the
+// attributes, and their values are only read after they are unmapped.
 class ArgumentsObject : public JSObject {
  public:
-  static Handle<ArgumentsObject> New(size_t len) {
-    Handle<JSObject> jsobj = JSObject::New<0, 0>(
-      CLASS_ARGUMENTS, true, Handle<JSValue>(), false, false, nullptr, len
+  static Handle<ArgumentsObject> New(
+    Handle<FunctionObject> callee, Handle<EnvironmentRecord> env, size_t len
+  ) {
+    Handle<JSObject> jsobj = JSObject::New<kArgumentsObjectOffset - kJSObjectOffset, 0>(
+      CLASS_ARGUMENTS, true, Handle<JSValue>(), false, false, nullptr, len, 2
     );
+    SET_HANDLE_VALUE(jsobj.val(), kCalleeOffset, callee, FunctionObject);
+    SET_HANDLE_VALUE(jsobj.val(), kEnvOffset, env, EnvironmentRecord);
+    SET_VALUE(jsobj.val(), kMappedOffset, 0, uint64_t);
 
     jsobj.val()->SetType(OBJ_ARGUMENTS);
 
@@ -24,6 +33,49 @@ class ArgumentsObject : public JSObject {
     AddValueProperty(obj, String::Length(), Number::New(len), true, false, true);
     return obj;
   }
+
+  // The value of the arguments binding of a call before the object is
+  // created, see LazyArguments.
+  static JSValue* Pending() {
+    static Handle<JSValue> singleton = [] {
+      Handle<JSValue> jsval = HeapObject::New<kSizeTSize, GCFlag::CONST>();
+      SET_VALUE(jsval.val(), FixedArray::kSizeOffset, 0, size_t);
+      jsval.val()->SetType(FIXED_ARRAY);
+      return jsval;
+    }();
+    return singleton.val();
+  }
+
+  // Only the first kMaxNumMapped indices are mapped this way.
+  bool IsMapped(Handle<String> P) {
+    return P.val()->IsArrayIndex() && IsMapped(P.val()->Index());
+  }
+  bool IsMapped(uint32_t index) {
+    return index < kMaxNumMapped && (mapped() & (uint64_t(1) << index));
+  }
+  void Map(size_t index) { SET_VALUE(this, kMappedOffset, mapped() | (uint64_t(1) << index), uint64_t); }
+  void Unmap(Handle<String> P) {
+    SET_VALUE(this, kMappedOffset, mapped() & ~(uint64_t(1) << P.val()->Index()), uint64_t);
+  }
+
+  // The name of the parameter that the mapped index P refers to.
+  Handle<String> ParameterName(Handle<String> P) { return ParameterName(P.val()->Index()); }
+  Handle<String> ParameterName(uint32_t index) {
+    FunctionObject* callee = READ_VALUE(this, kCalleeOffset, FunctionObject*);
+    return callee->FormalParameters()[index];
+  }
+  Handle<EnvironmentRecord> env() { return READ_HANDLE_VALUE(this, kEnvOffset, EnvironmentRecord); }
+
+  static constexpr size_t kMaxNumMapped = 64;
+
+ public:
+  static constexpr size_t kCalleeOffset = kJSObjectOffset;
+  static constexpr size_t kEnvOffset = kCalleeOffset + kPtrSize;
+  static constexpr size_t kMappedOffset = kEnvOffset + kPtrSize;
+  static constexpr size_t kArgumentsObjectOffset = kMappedOffset + sizeof(uint64_t);
+
+ private:
+  uint64_t mapped() { return READ_VALUE(this, kMappedOffset, uint64_t); }
 };
 
 class GetterSetter : public JSValue {
@@ -54,9 +106,12 @@ class GetterSetter : public JSValue {
 };
 
 Handle<JSValue> Get__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P);
+StackPropertyDescriptor GetOwnProperty__Arguments(Handle<ArgumentsObject> O, Handle<String> P);
+bool DefineOwnProperty__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, StackPropertyDescriptor desc, bool throw_flag);
+bool UpdateOwnProperty__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag);
 bool Delete__Arguments(Handle<Error>& e, Handle<ArgumentsObject> O, Handle<String> P, bool throw_flag);
 
-Handle<JSValue> Call__GetterSetter(Handle<Error>& e, Handle<GetterSetter> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
+Handle<JSValue> Call__GetterSetter(Handle<Error>& e, Handle<GetterSetter> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
 
 }  // namespace es
 
@@ -26,72 +26,72 @@ class ArrayProto : public JSObject {
   }
 
   // 15.4.4.2 Array.prototype.toString ( )
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> concat(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> concat(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> join(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> join(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
   // 15.4.4.6 Array.prototype.pop ( )
-  static Handle<JSValue> pop(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> pop(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
   // 15.4.4.7 Array.prototype.push ( [ item1 [ , item2 [ , … ] ] ] )
-  static Handle<JSValue> push(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> push(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> reverse(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> reverse(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
   // 15.4.4.9 Array.prototype.shift ( )
-  static Handle<JSValue> shift(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> shift(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> slice(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> slice(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> sort(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> sort(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> splice(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> splice(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> unshift(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> unshift(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> indexOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> indexOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> lastIndexOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> lastIndexOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> every(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> every(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> some(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> some(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> forEach(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> forEach(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> toLocaleUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> map(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> map(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> filter(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> filter(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> reduce(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> reduce(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> reduceRight(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> reduceRight(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
@@ -135,14 +135,14 @@ class ArrayConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> isArray(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isArray(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0 || !vals[0].val()->IsObject())
       return Bool::False();
     Handle<JSObject> obj = static_cast<Handle<JSObject>>(vals[0]);
     return Bool::Wrap(obj.val()->Class() == CLASS_ARRAY);
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Array() { [native code] }");
   }
 
@@ -158,7 +158,7 @@ class ArrayConstructor : public JSObject {
 };
 
 bool DefineOwnProperty__Array(Handle<Error>& e, Handle<ArrayObject> O, Handle<String> P, StackPropertyDescriptor desc, bool throw_flag);
-Handle<JSObject> Construct__ArrayConstructor(Handle<Error>& e, Handle<ArrayConstructor> O,  std::vector<Handle<JSValue>> arguments);
+Handle<JSObject> Construct__ArrayConstructor(Handle<Error>& e, Handle<ArrayConstructor> O,  Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
@@ -15,8 +15,8 @@ class BoolProto : public JSObject {
   }
 
   // 15.6.4.2 Boolean.prototype.toString ( )
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (val.val()->IsBool()) {
       return ToBoolean(val) ? String::True() : String::False();
     } else if (val.val()->IsBoolObject()) {
@@ -29,8 +29,8 @@ class BoolProto : public JSObject {
   }
 
   // 15.6.4.3 Boolean.prototype.valueOf ( )
-  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (val.val()->IsBool()) {
       return val;
     } else if (val.val()->IsBoolObject()) {
@@ -74,7 +74,7 @@ class BoolConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Bool() { [native code] }");
   }
 
@@ -89,8 +89,8 @@ class BoolConstructor : public JSObject {
   }
 };
 
-Handle<JSValue> Call__BoolConstructor(Handle<Error>& e, Handle<BoolConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSObject> Construct__BoolConstructor(Handle<Error>& e, Handle<BoolConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__BoolConstructor(Handle<Error>& e, Handle<BoolConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSObject> Construct__BoolConstructor(Handle<Error>& e, Handle<BoolConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
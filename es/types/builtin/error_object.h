@@ -12,8 +12,8 @@ class ErrorProto : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (unlikely(!val.val()->IsObject())) {
       e = Error::TypeError(u"Error.prototype.toString called with non-object value");
       return Handle<JSValue>();
@@ -44,7 +44,7 @@ class ErrorProto : public JSObject {
 class ErrorObject : public JSObject {
  public:
   static Handle<ErrorObject> New(Handle<Error> e) {
-    Handle<JSObject> jsobj = JSObject::New<kPtrSize>(
+    Handle<JSObject> jsobj = JSObject::New<4 * kPtrSize>(
       CLASS_ERROR, true, Handle<JSValue>(), false, false, nullptr
     );
 
@@ -53,16 +53,43 @@ class ErrorObject : public JSObject {
     jsobj.val()->SetType(OBJ_ERROR);
     Handle<ErrorObject> obj(jsobj);
     obj.val()->SetPrototype(ErrorProto::Instance());
-    AddValueProperty(obj, String::message(), e.val()->value(), true, false, false);
+    if (e.val()->has_pending_message()) {
+      // The error may be caught and dropped, so the message is kept in parts
+      // until "message" is looked up.
+      SET_HANDLE_VALUE(obj.val(), kMessageNameOffset, e.val()->message_name(), String);
+      SET_VALUE(obj.val(), kMessagePrefixOffset, e.val()->message_prefix(), const char16_t*);
+      SET_VALUE(obj.val(), kMessageSuffixOffset, e.val()->message_suffix(), const char16_t*);
+      obj.val()->named_properties()->set_has_pending_properties(true);
+    } else {
+      AddValueProperty(obj, String::message(), e.val()->value(), true, false, false);
+    }
     return obj;
   }
 
+  static void MaterializeProperties(Handle<ErrorObject> obj) {
+    ASSERT(obj.val()->named_properties()->has_pending_properties());
+    obj.val()->named_properties()->set_has_pending_properties(false);
+    std::u16string message = Error::FormatMessage(
+      READ_VALUE(obj.val(), kMessagePrefixOffset, const char16_t*),
+      READ_VALUE(obj.val(), kMessageNameOffset, String*),
+      READ_VALUE(obj.val(), kMessageSuffixOffset, const char16_t*));
+    Handle<String> msg = message == u"" ? String::Empty() : String::New(message);
+    AddValueProperty(obj, String::message(), msg, true, false, false);
+  }
+
+  static bool IsPendingProperty(Handle<String> P) {
+    return StringEqual(P, String::message());
+  }
+
   Handle<Error> e() { return READ_HANDLE_VALUE(this, kErrorOffset, Error); }
   Error::ErrorType ErrorType() { return e().val()->error_type(); }
   Handle<JSValue> ErrorValue() { return e().val()->value(); }
 
  public:
   static constexpr size_t kErrorOffset = kJSObjectOffset;
+  static constexpr size_t kMessageNameOffset = kErrorOffset + kPtrSize;
+  static constexpr size_t kMessagePrefixOffset = kMessageNameOffset + kPtrSize;
+  static constexpr size_t kMessageSuffixOffset = kMessagePrefixOffset + kPtrSize;
 };
 
 class ErrorConstructor : public JSObject {
@@ -72,7 +99,7 @@ class ErrorConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Error() { [native code] }");
   }
 
@@ -87,7 +114,9 @@ class ErrorConstructor : public JSObject {
   }
 };
 
-Handle<JSObject> Construct__ErrorConstructor(Handle<Error>& e, Handle<ErrorConstructor> O, std::vector<Handle<JSValue>> arguments);
+StackPropertyDescriptor GetOwnProperty__Error(Handle<ErrorObject> O, Handle<String> P);
+bool UpdateOwnProperty__Error(Handle<Error>& e, Handle<ErrorObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag);
+Handle<JSObject> Construct__ErrorConstructor(Handle<Error>& e, Handle<ErrorConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
@@ -19,7 +19,7 @@ Completion EvalProgram(AST* ast);
 class FunctionObject;
 void EnterFunctionCode(
   Handle<Error>& e, Handle<FunctionObject> func, ProgramOrFunctionBody* body,
-  Handle<JSValue> this_arg, std::vector<Handle<JSValue>> args, bool strict,
+  Handle<JSValue> this_arg, Span<Handle<JSValue>> args, bool strict,
   Handle<EnvironmentRecord> local_env
 );
 
@@ -30,49 +30,13 @@ class FunctionProto : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
   // 15.3.4.3 Function.prototype.apply (thisArg, argArray)
-  static Handle<JSValue> apply(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
-    if (!val.val()->IsObject()) {
-      e = Error::TypeError(u"Function.prototype.apply called on non-object");
-      return Handle<JSValue>();
-    }
-    Handle<JSObject> func = static_cast<Handle<JSObject>>(val);
-    if (!func.val()->IsCallable()) {
-      e = Error::TypeError(u"Function.prototype.apply called on non-callable");
-      return Handle<JSValue>();
-    }
-    if (vals.size() == 0) {
-      return Call(e, func, Undefined::Instance(), {});
-    }
-    if (vals.size() < 2 || vals[1].val()->IsNull() || vals[1].val()->IsUndefined()) {  // 2
-      return Call(e, func, vals[0], {});
-    }
-    if (!vals[1].val()->IsObject()) {  // 3
-      e = Error::TypeError(u"Function.prototype.apply's argument is non-object");
-      return Handle<JSValue>();
-    }
-    Handle<JSObject> arg_array = static_cast<Handle<JSObject>>(vals[1]);
-    Handle<JSValue> len = Get(e, arg_array, String::Length());
-    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    size_t n = ToNumber(e, len);
-    std::vector<Handle<JSValue>> arg_list;  // 6
-    size_t index = 0;  // 7
-    while (index < n) {  // 8
-      Handle<String> index_name = ::es::NumberToString(index);
-      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-      Handle<JSValue> next_arg = Get(e, arg_array, index_name);
-      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-      arg_list.emplace_back(next_arg);
-      index++;
-    }
-    return Call(e, func, vals[0], arg_list);
-  }
+  static Handle<JSValue> apply(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> call(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> call(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (!val.val()->IsObject()) {
       e = Error::TypeError(u"Function.prototype.call called on non-object");
       return Handle<JSValue>();
@@ -83,14 +47,13 @@ class FunctionProto : public JSObject {
       return Handle<JSValue>();
     }
     if (vals.size()) {
-      Handle<JSValue> this_arg = vals[0];
-      return Call(e, func, this_arg, std::vector<Handle<JSValue>>(vals.begin() + 1, vals.end()));
+      return Call(e, func, vals[0], vals.subspan(1));
     } else {
       return Call(e, func, Undefined::Instance(), {});
     }
   }
 
-  static Handle<JSValue> bind(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> bind(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
  private:
   template<flag_t flag>
@@ -120,6 +83,11 @@ class FunctionObject : public JSObject {
       SET_VALUE(jsobj.val(), kCodeOffset, nullptr, ProgramOrFunctionBody*);
     }
     SET_HANDLE_VALUE(jsobj.val(), kScopeOffset, scope, EnvironmentRecord);
+    // The closure keeps its scope alive, so that the env of the enclosing
+    // call is not reused. The count is never released, see
+    // ExtracGC::FunctionEnvRecFreeList.
+    if (!scope.IsNullptr())
+      scope.val()->AddRefCount();
     jsobj.val()->h_.strict = strict;
     jsobj.val()->SetType(OBJ_FUNC);
 
@@ -127,19 +95,31 @@ class FunctionObject : public JSObject {
     // 13.2 Creating Function Objects
     obj.val()->SetPrototype(FunctionProto::Instance());
     // Whether the function is made from bind.
-    if (func_ast != nullptr) {
-      AddValueProperty(obj, String::Length(), Number::New(func_ast->params().size()), false, false, false);  // 14 & 15
-      Handle<JSObject> proto = Object::New();  // 16
-      AddValueProperty(proto, String::Constructor(), obj, true, false, true);
-      // 15.3.5.2 prototype
-      AddValueProperty(obj, String::Prototype(), proto, true, false, false);
-      if (strict) {
-        // TODO(zhuzilin) thrower
-      }
-    }
+    if (func_ast != nullptr)
+      obj.val()->named_properties()->set_has_pending_properties(true);
     return obj;
   }
 
+  // 13.2 steps 14 to 18. Most closures are never constructed, so the
+  // properties are only added when either of them is first looked up.
+  static void MaterializeProperties(Handle<FunctionObject> obj) {
+    ASSERT(obj.val()->named_properties()->has_pending_properties());
+    obj.val()->named_properties()->set_has_pending_properties(false);
+    Function* func_ast = obj.val()->Code();
+    AddValueProperty(obj, String::Length(), Number::New(func_ast->params().size()), false, false, false);  // 14 & 15
+    Handle<JSObject> proto = Object::New();  // 16
+    AddValueProperty(proto, String::Constructor(), obj, true, false, true);
+    // 15.3.5.2 prototype
+    AddValueProperty(obj, String::Prototype(), proto, true, false, false);
+    if (obj.val()->strict()) {
+      // TODO(zhuzilin) thrower
+    }
+  }
+
+  static bool IsPendingProperty(Handle<String> P) {
+    return StringEqual(P, String::Length()) || StringEqual(P, String::Prototype());
+  }
+
   Handle<EnvironmentRecord> Scope() {
     ASSERT(!from_bind());
     return READ_HANDLE_VALUE(this, kScopeOffset, EnvironmentRecord);
@@ -167,15 +147,31 @@ class FunctionObject : public JSObject {
 class BindFunctionObject : public FunctionObject {
  public:
   static Handle<BindFunctionObject> New(
-    Handle<JSObject> target_function, Handle<JSValue> bound_this, std::vector<Handle<JSValue>> bound_args
+    Handle<JSObject> target_function, Handle<JSValue> bound_this, Span<Handle<JSValue>> bound_args
   ) {
     Handle<FunctionObject> func = FunctionObject::New(
       nullptr, Handle<JSValue>(), Runtime::TopContext().strict(),
       kBindFunctionObjectOffset - kFunctionObjectOffset);
 
+    // A bound function that is bound again binds the same target, with the
+    // this of the inner one, which is the one the target sees, and the
+    // arguments of both, so a call or construct goes through one level.
+    Handle<FixedArray> inner_args;
+    if (target_function.val()->type() == OBJ_BIND_FUNC) {
+      Handle<BindFunctionObject> inner = static_cast<Handle<BindFunctionObject>>(target_function);
+      target_function = inner.val()->TargetFunction();
+      bound_this = inner.val()->BoundThis();
+      inner_args = inner.val()->BoundArgs();
+    }
+    size_t num_inner_args = inner_args.IsNullptr() ? 0 : inner_args.val()->size();
+    Handle<FixedArray> args = FixedArray::New(num_inner_args + bound_args.size());
+    for (size_t i = 0; i < num_inner_args; i++)
+      args.val()->Set(i, inner_args.val()->Get(i));
+    for (size_t i = 0; i < bound_args.size(); i++)
+      args.val()->Set(num_inner_args + i, bound_args[i]);
     SET_HANDLE_VALUE(func.val(), kTargetFunctionOffset, target_function, JSObject);
     SET_HANDLE_VALUE(func.val(), kBoundThisOffset, bound_this, JSValue);
-    SET_HANDLE_VALUE(func.val(), kBoundArgsOffset, FixedArray::New<JSValue>(bound_args), FixedArray);
+    SET_HANDLE_VALUE(func.val(), kBoundArgsOffset, args, FixedArray);
     func.val()->SetType(OBJ_BIND_FUNC);
     return Handle<BindFunctionObject>(func);
   }
@@ -198,7 +194,7 @@ class FunctionConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Function() { [native code] }");
   }
 
@@ -213,8 +209,8 @@ class FunctionConstructor : public JSObject {
   }
 };
 
-Handle<JSValue> FunctionProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSValue> val = Runtime::TopValue();
+Handle<JSValue> FunctionProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSValue> val = this_arg;
   if (!val.val()->IsObject()) {
     e = Error::TypeError(u"Function.prototype.toString called on non-object");
     return Handle<JSValue>();
@@ -229,7 +225,8 @@ Handle<JSValue> FunctionProto::toString(Handle<Error>& e, Handle<JSValue> this_a
   if (params.size() > 0) {
     str += params[0].val()->data();
     for (size_t i = 1; i < params.size(); i++) {
-      str += u"," + params[i].val()->data();
+      str += u',';
+      str += params[i].val()->data();
     }
   }
   str += u")";
@@ -237,8 +234,8 @@ Handle<JSValue> FunctionProto::toString(Handle<Error>& e, Handle<JSValue> this_a
 }
 
 // 15.3.4.5 Function.prototype.bind (thisArg [, arg1 [, arg2, …]])
-Handle<JSValue> FunctionProto::bind(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSValue> val = Runtime::TopValue();
+Handle<JSValue> FunctionProto::bind(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSValue> val = this_arg;
   if (!val.val()->IsCallable()) {
     e = Error::TypeError(u"Function.prototype.call called on non-callable");
     return Handle<JSValue>();
@@ -247,10 +244,7 @@ Handle<JSValue> FunctionProto::bind(Handle<Error>& e, Handle<JSValue> this_arg,
   Handle<JSValue> this_arg_for_F = Undefined::Instance();
   if (vals.size() > 0)
     this_arg_for_F = vals[0];
-  std::vector<Handle<JSValue>> A;
-  if (vals.size() > 1) {
-    A = std::vector<Handle<JSValue>>(vals.begin() + 1, vals.end());
-  }
+  Span<Handle<JSValue>> A = vals.subspan(1);
   Handle<BindFunctionObject> F = BindFunctionObject::New(target, this_arg_for_F, A);
   size_t len = 0;
   if (target.val()->Class() == CLASS_FUNCTION) {
@@ -288,7 +282,7 @@ Handle<FunctionObject> InstantiateFunctionDeclaration(Handle<Error>& e, Function
       }
       for (VarDecl* d : body->var_decls()) {
         if (d->is_strict_future()) {
-          e = Error::SyntaxError(u"Unexpected future reserved word " + d->ident().val()->data() + u" in strict mode");
+          e = Error::SyntaxError(u"Unexpected future reserved word ", d->ident(), u" in strict mode");
           return Handle<JSValue>();
         }
         if (d->is_eval_or_arguments()) {
@@ -339,16 +333,18 @@ void AddFuncProperty(
 }
 
 Handle<JSValue> Get__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<String> P);
+StackPropertyDescriptor GetOwnProperty__Function(Handle<FunctionObject> O, Handle<String> P);
+bool UpdateOwnProperty__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag);
 bool HasInstance__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<JSValue> V);
 bool HasInstance__BindFunction(Handle<Error>& e, Handle<BindFunctionObject> O, Handle<JSValue> V);
 
-Handle<JSValue> Call__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments);
-Handle<JSValue> Call__BindFunction(Handle<Error>& e, Handle<BindFunctionObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> extra_args);
-Handle<JSValue> Call__FunctionProto(Handle<Error>& e, Handle<FunctionProto> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__Function(Handle<Error>& e, Handle<FunctionObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments);
+Handle<JSValue> Call__BindFunction(Handle<Error>& e, Handle<BindFunctionObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> extra_args);
+Handle<JSValue> Call__FunctionProto(Handle<Error>& e, Handle<FunctionProto> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments);
 
-Handle<JSObject> Construct__Function(Handle<Error>& e, Handle<FunctionObject> O,std::vector<Handle<JSValue>> arguments);
-Handle<JSObject> Construct__BindFunction(Handle<Error>& e, Handle<BindFunctionObject> O, std::vector<Handle<JSValue>> extra_args);
-Handle<JSObject> Construct__FunctionConstructor(Handle<Error>& e, Handle<FunctionConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSObject> Construct__Function(Handle<Error>& e, Handle<FunctionObject> O,Span<Handle<JSValue>> arguments);
+Handle<JSObject> Construct__BindFunction(Handle<Error>& e, Handle<BindFunctionObject> O, Span<Handle<JSValue>> extra_args);
+Handle<JSObject> Construct__FunctionConstructor(Handle<Error>& e, Handle<FunctionConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
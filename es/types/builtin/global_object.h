@@ -7,7 +7,7 @@ namespace es {
 
 std::u16string ToU16String(Handle<Error>& e, Handle<JSValue> input);
 double ToInt32(Handle<Error>& e, Handle<JSValue> input);
-double StringToNumber(std::u16string source);
+double StringToNumber(const std::u16string& source);
 double ToNumber(Handle<Error>& e, Handle<JSValue> input);
 
 // 15.1 The Global Object
@@ -23,36 +23,36 @@ class GlobalObject : public JSObject {
     SET_VALUE(this, kDirectEvalOffset, direct_eval, bool);
   }
 
-  static Handle<JSValue> eval(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> eval(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> parseInt(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> parseInt(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> parseFloat(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> parseFloat(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> isNaN(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> isNaN(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
   // 15.1.2.5 isFinite (number)
-  static Handle<JSValue> isFinite(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isFinite(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
   // 15.1.3.1 decodeURI (encodedURI)
-  static Handle<JSValue> decodeURI(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> decodeURI(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
   // 15.1.3.2 decodeURIComponent (encodedURIComponent)
-  static Handle<JSValue> decodeURIComponent(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> decodeURIComponent(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
   // 15.1.3.3 encodeURI (uri)
-  static Handle<JSValue> encodeURI(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> encodeURI(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
   // 15.1.3.4 encodeURIComponent (uriComponent)
-  static Handle<JSValue> encodeURIComponent(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> encodeURIComponent(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
@@ -70,6 +70,7 @@ class GlobalObject : public JSObject {
     );
 
     SET_VALUE(jsobj.val(), kDirectEvalOffset, false, bool);
+    jsobj.val()->named_properties()->set_is_global();
     jsobj.val()->SetType(OBJ_GLOBAL);
     return Handle<GlobalObject>(jsobj);
   }
@@ -14,12 +14,12 @@ class Math : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"Math");
   }
 
   // 15.8.2.1 abs (x)
-  static Handle<JSValue> abs(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> abs(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -33,7 +33,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.6 ceil (x)
-  static Handle<JSValue> ceil(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> ceil(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -47,7 +47,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.7 cos (x)
-  static Handle<JSValue> cos(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> cos(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -61,7 +61,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.8 exp (x)
-  static Handle<JSValue> exp(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> exp(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -75,7 +75,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.9 floor (x)
-  static Handle<JSValue> floor(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> floor(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -89,7 +89,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.11 max ( [ value1 [ , value2 [ , … ] ] ] )
-  static Handle<JSValue> max(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> max(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NegativeInfinity();
     double value1 = ToNumber(e, vals[0]);
@@ -110,7 +110,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.13 pow (x, y)
-  static Handle<JSValue> pow(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> pow(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 2)
       return Number::NaN();
     double x = ToNumber(e, vals[0]);
@@ -126,7 +126,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.15 round (x)
-  static Handle<JSValue> round(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> round(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -140,7 +140,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.16 sin (x)
-  static Handle<JSValue> sin(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> sin(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
@@ -154,7 +154,7 @@ class Math : public JSObject {
   }
 
   // 15.8.2.17 sqrt (x)
-  static Handle<JSValue> sqrt(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> sqrt(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
     double num = ToNumber(e, vals[0]);
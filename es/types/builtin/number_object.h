@@ -19,8 +19,8 @@ class NumberProto : public JSObject {
   }
 
   // 15.7.4.2 Number.prototype.toString ( [ radix ] )
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (!val.val()->IsNumber() && !val.val()->IsNumberObject()) {
       e = Error::TypeError(u"Number.prototype.toString called by non-number");
       return Handle<JSValue>();
@@ -41,12 +41,12 @@ class NumberProto : public JSObject {
     return NumberToString(num);
   }
 
-  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (val.val()->IsNumberObject()) {
       return static_cast<Handle<JSObject>>(val).val()->PrimitiveValue();
     } else if (val.val()->IsNumber()) {
@@ -56,15 +56,15 @@ class NumberProto : public JSObject {
     return Handle<JSValue>();
   }
 
-  static Handle<JSValue> toFixed(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toFixed(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> toExponential(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toExponential(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> toPrecision(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toPrecision(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
@@ -100,7 +100,7 @@ class NumberConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Number() { [native code] }");
   }
 
@@ -115,8 +115,8 @@ class NumberConstructor : public JSObject {
   }
 };
 
-Handle<JSValue> Call__NumberConstructor(Handle<Error>& e, Handle<NumberConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSObject> Construct__NumberConstructor(Handle<Error>& e, Handle<NumberConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__NumberConstructor(Handle<Error>& e, Handle<NumberConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSObject> Construct__NumberConstructor(Handle<Error>& e, Handle<NumberConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
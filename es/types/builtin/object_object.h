@@ -17,8 +17,8 @@ class ObjectProto : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (val.val()->IsUndefined())
       return String::New(u"[object Undefined]");
     if (val.val()->IsNull())
@@ -27,19 +27,19 @@ class ObjectProto : public JSObject {
     return String::New(u"[object " + ClassToString(obj.val()->Class()) + u"]");
   }
 
-  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     Handle<JSObject> O = ToObject(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     // TODO(zhuzilin) Host object
     return O;
   }
 
-  static Handle<JSValue> hasOwnProperty(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> hasOwnProperty(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     Handle<String> P;
     if (vals.size() == 0)
       P = ::es::ToString(e, Undefined::Instance());
@@ -47,7 +47,7 @@ class ObjectProto : public JSObject {
       P = ::es::ToString(e, vals[0]);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
 
-    Handle<JSValue> val = Runtime::TopValue();
+    Handle<JSValue> val = this_arg;
     Handle<JSObject> O = ToObject(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
 
@@ -55,10 +55,10 @@ class ObjectProto : public JSObject {
     return Bool::Wrap(!desc.IsUndefined());
   }
 
-  static Handle<JSValue> isPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (unlikely(vals.size() == 0 || !vals[0].val()->IsObject()))
       return Bool::False();
-    Handle<JSValue> val = Runtime::TopValue();
+    Handle<JSValue> val = this_arg;
     Handle<JSObject> O = ToObject(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<JSValue> V = static_cast<Handle<JSObject>>(vals[0]).val()->Prototype();
@@ -70,7 +70,7 @@ class ObjectProto : public JSObject {
     return Bool::False();
   }
 
-  static Handle<JSValue> propertyIsEnumerable(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> propertyIsEnumerable(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
@@ -107,7 +107,7 @@ class ObjectConstructor : public JSObject {
   }
 
   // 15.2.3.2 Object.getPrototypeOf ( O )
-  static Handle<JSValue> getPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> getPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 1 || !vals[0].val()->IsObject()) {
       e = Error::TypeError();
       return Handle<JSValue>();
@@ -116,7 +116,7 @@ class ObjectConstructor : public JSObject {
   }
 
   // 15.2.3.3 Object.getOwnPropertyDescriptor ( O, P )
-  static Handle<JSValue> getOwnPropertyDescriptor(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> getOwnPropertyDescriptor(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 1 || !vals[0].val()->IsObject()) {
       e = Error::TypeError(u"Object.create called on non-object");
       return Handle<JSValue>();
@@ -127,11 +127,10 @@ class ObjectConstructor : public JSObject {
     return FromPropertyDescriptor(desc);
   }
 
-  static Handle<JSValue> getOwnPropertyNames(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    assert(false);
-  }
+  // 15.2.3.4 Object.getOwnPropertyNames ( O )
+  static Handle<JSValue> getOwnPropertyNames(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> create(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> create(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 1 || (!vals[0].val()->IsObject() && !vals[0].val()->IsNull())) {
       e = Error::TypeError(u"Object.create called on non-object");
       return Handle<JSValue>();
@@ -145,7 +144,7 @@ class ObjectConstructor : public JSObject {
     return obj;
   }
 
-  static Handle<JSValue> defineProperty(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> defineProperty(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 1 || !vals[0].val()->IsObject()) {
       e = Error::TypeError(u"Object.defineProperty called on non-object");
       return Handle<JSValue>();
@@ -163,19 +162,19 @@ class ObjectConstructor : public JSObject {
     return O;
   }
 
-  static Handle<JSValue> defineProperties(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> defineProperties(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> seal(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> seal(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> freeze(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> freeze(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> preventExtensions(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> preventExtensions(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0 || !vals[0].val()->IsObject()) {
       e = Error::TypeError(u"Object.preventExtensions called on non-object");
       return Handle<JSValue>();
@@ -185,15 +184,15 @@ class ObjectConstructor : public JSObject {
     return obj;
   }
 
-  static Handle<JSValue> isSealed(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isSealed(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> isFrozen(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isFrozen(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> isExtensible(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> isExtensible(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 1 || !vals[0].val()->IsObject()) {
       e = Error::TypeError(u"Object.isExtensible called on non-object");
       return Handle<JSValue>();
@@ -202,10 +201,10 @@ class ObjectConstructor : public JSObject {
     return Bool::Wrap(obj.val()->Extensible());
   }
 
-  static Handle<JSValue> keys(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> keys(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
   // ES6
-  static Handle<JSValue> setPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> setPrototypeOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() < 2) {
       e = Error::TypeError(u"Object.preventExtensions need 2 arguments");
       return Handle<JSValue>(); 
@@ -223,7 +222,7 @@ class ObjectConstructor : public JSObject {
     return vals[0];
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function Object() { [native code] }");
   }
 
@@ -238,8 +237,8 @@ class ObjectConstructor : public JSObject {
   }
 };
 
-Handle<JSValue> Call__ObjectConstructor(Handle<Error>& e, Handle<ObjectConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSObject> Construct__ObjectConstructor(Handle<Error>& e, Handle<ObjectConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__ObjectConstructor(Handle<Error>& e, Handle<ObjectConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSObject> Construct__ObjectConstructor(Handle<Error>& e, Handle<ObjectConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
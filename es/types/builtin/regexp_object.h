@@ -15,15 +15,15 @@ class RegExpProto : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> exec(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> exec(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> test(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> test(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
  private:
   template<flag_t flag>
@@ -96,7 +96,7 @@ class RegExpConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function RegExp() { [native code] }");
   }
 
@@ -111,8 +111,8 @@ class RegExpConstructor : public JSObject {
   }
 };
 
-Handle<JSValue> RegExpProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-  Handle<JSValue> val = Runtime::TopValue();
+Handle<JSValue> RegExpProto::toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+  Handle<JSValue> val = this_arg;
   if (!val.val()->IsRegExpObject()) {
     e = Error::TypeError(u"RegExp.prototype.toString called by non-regex");
     return Handle<JSValue>();
@@ -126,8 +126,8 @@ Handle<JSValue> RegExpProto::toString(Handle<Error>& e, Handle<JSValue> this_arg
   );
 }
 
-Handle<JSValue> Call__RegExpConstructor(Handle<Error>& e, Handle<RegExpConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSObject> Construct__RegExpConstructor(Handle<Error>& e, Handle<RegExpConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__RegExpConstructor(Handle<Error>& e, Handle<RegExpConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSObject> Construct__RegExpConstructor(Handle<Error>& e, Handle<RegExpConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
@@ -20,8 +20,8 @@ class StringProto : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (val.val()->IsString()) {
       return val;
     }
@@ -32,8 +32,8 @@ class StringProto : public JSObject {
     return static_cast<Handle<JSObject>>(val).val()->PrimitiveValue();
   }
 
-  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> valueOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     if (unlikely(!val.val()->IsStringObject())) {
       if (!val.val()->IsObject()) {
         e = Error::TypeError(u"String.prototype.valueOf called with non-object");
@@ -45,10 +45,10 @@ class StringProto : public JSObject {
     return static_cast<JSObject*>(val.val())->PrimitiveValue();
   }
 
-  static Handle<JSValue> charAt(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> charAt(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return String::Empty();
-    Handle<JSValue> val = Runtime::TopValue();
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
@@ -60,10 +60,10 @@ class StringProto : public JSObject {
     return String::Substr(S, position, 1);
   }
 
-  static Handle<JSValue> charCodeAt(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> charCodeAt(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
-    Handle<JSValue> val = Runtime::TopValue();
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
@@ -75,33 +75,32 @@ class StringProto : public JSObject {
     return Number::New((double)(S.val()->get(position)));
   }
 
-  static Handle<JSValue> concat(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> concat(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    std::vector<Handle<JSValue>> args = vals;
     std::vector<Handle<String>> strs = {S};
-    for (auto arg : args) {
+    for (auto arg : vals) {
       strs.emplace_back(::es::ToString(e, arg));
       if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     }
     return String::Concat(strs);
   }
 
-  static Handle<JSValue> indexOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> indexOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    std::u16string S = ToU16String(e, val);
+    Handle<String> S = ::es::ToString(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<JSValue> search_string;
     if (vals.size() == 0)
       search_string = Undefined::Instance();
     else
       search_string = vals[0];
-    std::u16string search_str = ToU16String(e, search_string);
+    Handle<String> search_str = ::es::ToString(e, search_string);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     double pos;
     if (vals.size() < 2 || vals[1].val()->IsUndefined())
@@ -110,26 +109,26 @@ class StringProto : public JSObject {
       pos = ToInteger(e, vals[1]);
       if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     }
-    int start = fmin(fmax(pos, 0), S.size());
-    size_t find_pos = S.find(search_str, start);
-    if (find_pos != std::u16string::npos) {
+    int start = fmin(fmax(pos, 0), S.val()->size());
+    size_t find_pos = StringFind(S.val(), search_str.val(), start);
+    if (find_pos != simd::npos) {
       return Number::New(find_pos);
     }
     return Number::New(-1);
   }
 
-  static Handle<JSValue> lastIndexOf(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> lastIndexOf(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
-    std::u16string S = ToU16String(e, val);
+    Handle<String> S = ::es::ToString(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<JSValue> search_string;
     if (vals.size() == 0)
       search_string = Undefined::Instance();
     else
       search_string = vals[0];
-    std::u16string search_str = ToU16String(e, search_string);
+    Handle<String> search_str = ::es::ToString(e, search_string);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     double pos;
     if (vals.size() < 2 || vals[1].val()->IsUndefined())
@@ -140,42 +139,61 @@ class StringProto : public JSObject {
     }
     int start;
     if (isnan(pos))
-      start = S.size();
+      start = S.val()->size();
     else
-      start = fmin(fmax(pos, 0), S.size());
-    size_t find_pos = S.rfind(search_str, start);
-    if (find_pos != std::u16string::npos) {
+      start = fmin(fmax(pos, 0), S.val()->size());
+    size_t find_pos = StringRFind(S.val(), search_str.val(), start);
+    if (find_pos != simd::npos) {
       return Number::New(find_pos);
     }
     return Number::New(-1);
   }
 
-  static Handle<JSValue> localeCompare(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> localeCompare(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> match(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> match(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> replace(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> replace(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> search(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> search(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
-  static Handle<JSValue> slice(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    assert(false);
+  static Handle<JSValue> slice(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
+    CheckObjectCoercible(e, val);
+    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    Handle<String> S = ::es::ToString(e, val);
+    if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    double len = S.val()->size();
+    double int_start = 0;
+    if (vals.size() > 0) {
+      int_start = ToInteger(e, vals[0]);
+      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    }
+    double int_end = len;
+    if (vals.size() > 1 && !vals[1].val()->IsUndefined()) {
+      int_end = ToInteger(e, vals[1]);
+      if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
+    }
+    double from = int_start < 0 ? fmax(len + int_start, 0) : fmin(int_start, len);
+    double to = int_end < 0 ? fmax(len + int_end, 0) : fmin(int_end, len);
+    double span = fmax(to - from, 0);
+    return String::Substr(S, from, span);
   }
 
-  static Handle<JSValue> split(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals);
+  static Handle<JSValue> split(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals);
 
-  static Handle<JSValue> substring(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> substring(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     if (vals.size() == 0)
       return Number::NaN();
-    Handle<JSValue> val = Runtime::TopValue();
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
@@ -197,8 +215,8 @@ class StringProto : public JSObject {
     return String::Substr(S, from, to - from);
   }
 
-  static Handle<JSValue> toLowerCase(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toLowerCase(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
@@ -208,13 +226,13 @@ class StringProto : public JSObject {
     return String::New(L);
   }
 
-  static Handle<JSValue> toLocaleLowerCase(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleLowerCase(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     // TODO(zhuzilin) may need to fix this.
     return toLowerCase(e, this_arg, vals);
   }
 
-  static Handle<JSValue> toUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
-    Handle<JSValue> val = Runtime::TopValue();
+  static Handle<JSValue> toUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
+    Handle<JSValue> val = this_arg;
     CheckObjectCoercible(e, val);
     if (unlikely(!e.val()->IsOk())) return Handle<JSValue>();
     Handle<String> S = ::es::ToString(e, val);
@@ -224,12 +242,12 @@ class StringProto : public JSObject {
     return String::New(U);
   }
 
-  static Handle<JSValue> toLocaleUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toLocaleUpperCase(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     // TODO(zhuzilin) may need to fix this.
     return toUpperCase(e, this_arg, vals);
   }
 
-  static Handle<JSValue> trim(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> trim(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     assert(false);
   }
 
@@ -268,7 +286,7 @@ class StringConstructor : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> fromCharCode(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> fromCharCode(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     std::u16string result = u"";
     for (Handle<JSValue> val : vals) {
       char16_t c = ToUint16(e, val);
@@ -278,7 +296,7 @@ class StringConstructor : public JSObject {
     return String::New(result);
   }
 
-  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> toString(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     return String::New(u"function String() { [native code] }");
   }
 
@@ -294,8 +312,8 @@ class StringConstructor : public JSObject {
 };
 
 StackPropertyDescriptor GetOwnProperty__String(Handle<StringObject> O, Handle<String> P);
-Handle<JSValue> Call__StringConstructor(Handle<Error>& e, Handle<StringConstructor> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSObject> Construct__StringConstructor(Handle<Error>& e, Handle<StringConstructor> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSValue> Call__StringConstructor(Handle<Error>& e, Handle<StringConstructor> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSObject> Construct__StringConstructor(Handle<Error>& e, Handle<StringConstructor> O, Span<Handle<JSValue>> arguments);
 
 }  // namespace es
 
@@ -1,6 +1,8 @@
 #ifndef ES_TYPES_COMPLETION
 #define ES_TYPES_COMPLETION
 
+#include <type_traits>
+
 #include <es/types/base.h>
 
 namespace es {
@@ -19,10 +21,11 @@ class Completion {
     THROW,
   };
 
-  Completion() : Completion(NORMAL, Handle<JSValue>(), u"") {}
+  Completion() : Completion(NORMAL, Handle<JSValue>(), 0) {}
 
-  Completion(Type type, Handle<JSValue> value, std::u16string target) :
-    type_(type), value_(value), target_(target) {}
+  // `target` is the id of the label from LabelTable, 0 for no label.
+  Completion(Type type, Handle<JSValue> value, uint32_t target) :
+    type_(type), target_(target), value_(value) {}
 
   Type type() { return type_; }
   Handle<JSValue> value() {
@@ -35,7 +38,7 @@ class Completion {
   void SetValue(JSValue* val) {
     value_ = Handle<JSValue>(val);
   }
-  const std::u16string& target() { return target_; }
+  uint32_t target() { return target_; }
 
   bool IsAbruptCompletion() { return type_ != NORMAL; }
   bool IsThrow() { return type_ == THROW; }
@@ -43,10 +46,13 @@ class Completion {
 
  private:
   Type type_;
+  uint32_t target_;
   Handle<JSValue> value_;
-  std::u16string target_;
 };
 
+static_assert(sizeof(Completion) == 16);
+static_assert(std::is_trivially_copyable_v<Completion>);
+
 }  // namespace es
 
 #endif  // ES_TYPES_COMPLETION
\ No newline at end of file
@@ -50,11 +50,9 @@ bool ToBoolean(Handle<JSValue> input) {
 }
 
 // 9.3.1 ToNumber Applied to the String Type
-double StringToNumber(std::u16string source) {
+double StringToNumber(const char16_t* source, size_t n) {
   size_t start = 0;
-  size_t end = source.size();
-  bool positive = true;
-  double val = 0;
+  size_t end = n;
   while (start < end) {
     char16_t c = source[start];
     if (!character::IsWhiteSpace(c) && !character::IsLineTerminator(c))
@@ -67,93 +65,11 @@ double StringToNumber(std::u16string source) {
       break;
     end--;
   }
-  // The MV of [empty] is 0
-  if (start == end) {
-    return 0;
-  } else if (source[start] == u'-') {
-    positive = false;
-    start++;
-  } else if (source[start] == u'+') {
-    start++;
-  } else if (end - start > 2 && source[start] == u'0' &&
-             (source[start + 1] == u'x' || source[start + 1] == u'X')){
-    // 0xABCD...
-    start += 2;
-    while (start < end) {
-      char16_t c = source[start];
-      if (!character::IsHexDigit(c))
-        goto error;
-      val = val * 16 + character::Digit(c);
-      start++;
-    }
-    return val;
-  }
-
-  if (start == end)
-    goto error;
-
-  if (source.substr(start, end - start) == u"Infinity") {
-    return positive ? Number::Infinity().val()->data() : Number::NegativeInfinity().val()->data();
-  }
-
-  while (start < end) {
-    char16_t c = source[start];
-    if (!character::IsDecimalDigit(c))
-      break;
-    val = val * 10 + character::Digit(c);
-    start++;
-  }
-  if (start == end)
-    return positive ? val : -val;
-  
-  if (source[start] == u'.') {
-    start++;
-    double frac = 0.1;
-    while (start < end) {
-      char16_t c = source[start];
-      if (!character::IsDecimalDigit(c)) {
-        break;
-      }
-      val += frac * character::Digit(c);
-      frac /= 10;
-      start++;
-    }
-    if (start == end)
-      return positive ? val : -val;
-  }
-
-  if (source[start] == u'e' || source[start] == u'E') {
-    start++;
-    double exp = 0;
-    bool exp_positive = true;
-    if (start == end)
-      goto error;
-    if (source[start] == u'-') {
-      exp_positive = false;
-      start++;
-    } else if (source[start] == u'-') {
-      start++;
-    }
-    if (start == end)
-      goto error;
+  return CharsToDouble(source + start, end - start);
+}
 
-    while (start < end) {
-      char16_t c = source[start];
-      if (!character::IsDecimalDigit(c)) {
-        break;
-      }
-      exp = exp * 10 + character::Digit(c);
-      start++;
-    }
-    if (!exp_positive)
-      exp = -exp;
-    if (start == end) {
-      val = val * pow(10, exp);
-      return positive ? val : -val;
-    }
-  }
-error:
-  return nan("");
+double StringToNumber(const std::u16string& source) {
+  return StringToNumber(source.data(), source.size());
 }
 
 constexpr char16_t max_uint32_str[11] = u"4294967295";
@@ -202,7 +118,7 @@ std::u16string ArrayIndexToString(uint32_t index) {
 double StringToNumber(Handle<String> str) {
   if (str.val()->IsArrayIndex())
     return str.val()->Index();
-  return StringToNumber(str.val()->data());
+  return StringToNumber(str.val()->c_str(), str.val()->size());
 }
 
 double ToNumber(Handle<Error>& e, Handle<JSValue> input) {
@@ -282,203 +198,13 @@ double ToUint16(Handle<Error>& e, Handle<JSValue> input) {
 }
 
 std::u16string NumberToU16String(double m) {
-  if (m == 0)
-    return u"0";
-  if (isnan(m))
-    return u"NaN";
-  if (isinf(m))
-    return signbit(m) ? u"-Infinity" : u"Infinity";
-  // TODO(zhuzilin) Figure out how to solve the large number error.
-  std::u16string sign = u"";
-  if (m < 0) {
-    m = -m;
-    sign = u"-";
-  }
-  // the fraction digits, e.g. 1.23's frac_digit = 2, 4200's = -2
-  int frac_digit = 0;
-  // the total digits, e.g. 1.23's k = 3, 4200's k = 2
-  int k = 0;
-  // n - k = -frac_digit
-  int n = 0;
-  double tmp;
-  while (modf(m, &tmp) != 0) {
-    frac_digit++;
-    m *= 10;
-  }
-  while (m != 0 && fmod(m, 10) < 1e-6) {
-    frac_digit--;
-    m /= 10;
-  }
-  double s = m;
-  while (m > 0.5) {
-    k++;
-    m /= 10;
-    modf(m, &tmp);
-    m = tmp;
-  }
-  n = k - frac_digit;
-  std::u16string res = u"";
-  if (k <= n && n <= 21) {
-    while (s > 0.5) {
-      res += u'0' + int(fmod(s, 10));
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    res += std::u16string(n - k, u'0');
-    return sign + res;
-  }
-  if (0 < n && n <= 21) {
-    for (int i = 0; i < k; i++) {
-      res += u'0' + int(fmod(s, 10));
-      if (i + 1 == k - n) {
-        res += u'.';
-      }
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    return sign + res;
-  }
-  if (-6 < n && n <= 0) {
-    for (int i = 0; i < k; i++) {
-      res += u'0' + int(fmod(s, 10));
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    res = u"0." + std::u16string(-n, u'0') + res;
-    return sign + res;
-  }
-  if (k == 1) {
-    res += u'0' + int(s);
-    res += u"e";
-    if (n - 1 > 0) {
-      res += u"+" + NumberToU16String(n - 1);
-    } else {
-      res += u"-" + NumberToU16String(1 - n);
-    }
-    return sign + res;
-  }
-  for (int i = 0; i < k; i++) {
-    res += u'0' + int(fmod(s, 10));
-    if (i + 1 == k - 1) {
-      res += u'.';
-    }
-    s /= 10;
-    modf(s, &tmp);
-    s = tmp;
-  }
-  res += u"e";
-  if (n - 1 > 0) {
-    res += u"+" + NumberToU16String(n - 1);
-  } else {
-    res += u"-" + NumberToU16String(1 - n);
-  }
-  return sign + res;
+  char16_t buf[kMaxDoubleCharsSize];
+  return std::u16string(buf, DoubleToChars(m, buf));
 }
 
 std::string NumberToStdString(double m) {
-  if (m == 0)
-    return "0";
-  if (isnan(m))
-    return "NaN";
-  if (isinf(m))
-    return signbit(m) ? "-Infinity" : "Infinity";
-  // TODO(zhuzilin) Figure out how to solve the large number error.
-  std::string sign = "";
-  if (m < 0) {
-    m = -m;
-    sign = "-";
-  }
-  // the fraction digits, e.g. 1.23's frac_digit = 2, 4200's = -2
-  int frac_digit = 0;
-  // the total digits, e.g. 1.23's k = 3, 4200's k = 2
-  int k = 0;
-  // n - k = -frac_digit
-  int n = 0;
-  double tmp;
-  while (modf(m, &tmp) != 0) {
-    frac_digit++;
-    m *= 10;
-  }
-  while (m != 0 && fmod(m, 10) < 1e-6) {
-    frac_digit--;
-    m /= 10;
-  }
-  double s = m;
-  while (m > 0.5) {
-    k++;
-    m /= 10;
-    modf(m, &tmp);
-    m = tmp;
-  }
-  n = k - frac_digit;
-  std::string res = "";
-  if (k <= n && n <= 21) {
-    while (s > 0.5) {
-      res += '0' + int(fmod(s, 10));
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    res += std::string(n - k, '0');
-    return sign + res;
-  }
-  if (0 < n && n <= 21) {
-    for (int i = 0; i < k; i++) {
-      res += '0' + int(fmod(s, 10));
-      if (i + 1 == k - n) {
-        res += '.';
-      }
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    return sign + res;
-  }
-  if (-6 < n && n <= 0) {
-    for (int i = 0; i < k; i++) {
-      res += '0' + int(fmod(s, 10));
-      s /= 10;
-      modf(s, &tmp);
-      s = tmp;
-    }
-    reverse(res.begin(), res.end());
-    res = "0." + std::string(-n, '0') + res;
-    return sign + res;
-  }
-  if (k == 1) {
-    res += '0' + int(s);
-    res += "e";
-    if (n - 1 > 0) {
-      res += "+" + NumberToStdString(n - 1);
-    } else {
-      res += "-" + NumberToStdString(1 - n);
-    }
-    return sign + res;
-  }
-  for (int i = 0; i < k; i++) {
-    res += '0' + int(fmod(s, 10));
-    if (i + 1 == k - 1) {
-      res += '.';
-    }
-    s /= 10;
-    modf(s, &tmp);
-    s = tmp;
-  }
-  res += "e";
-  if (n - 1 > 0) {
-    res += "+" + NumberToStdString(n - 1);
-  } else {
-    res += "-" + NumberToStdString(1 - n);
-  }
-  return sign + res;
+  char buf[kMaxDoubleCharsSize];
+  return std::string(buf, DoubleToChars(m, buf));
 }
 
 Handle<String> NumberToString(double m) {
@@ -488,7 +214,18 @@ Handle<String> NumberToString(double m) {
     return signbit(m) ? String::NegativeInfinity() : String::Infinity();
   if (static_cast<double>(static_cast<uint32_t>(m)) == m)
     return String::New(static_cast<uint32_t>(m));
-  return String::New(NumberToU16String(m));
+  Double2Uint64 bits;
+  bits.double_ = m;
+  ExtracGC::NumberStringCacheEntry& entry = ExtracGC::number_string_cache[
+    (bits.uint64_ ^ (bits.uint64_ >> 32)) & (ExtracGC::kNumberStringCacheSize - 1)];
+  if (entry.val != nullptr && entry.key == m)
+    return Handle<String>(entry.val);
+  char16_t buf[kMaxDoubleCharsSize];
+  Handle<String> str = String::New(buf, DoubleToChars(m, buf));
+  // Set after the allocation, which may clear the cache.
+  entry.key = m;
+  entry.val = str.val();
+  return str;
 }
 
 Handle<String> NumberToStringConst(double m) {
@@ -501,7 +238,8 @@ Handle<String> NumberToStringConst(double m) {
     return signbit(m) ? String::NegativeInfinity() : String::Infinity();
   if (static_cast<double>(static_cast<uint32_t>(m)) == m)
     return String::New(static_cast<uint32_t>(m));
-  return String::New<GCFlag::CONST>(NumberToU16String(m));
+  char16_t buf[kMaxDoubleCharsSize];
+  return String::New<GCFlag::CONST>(buf, DoubleToChars(m, buf));
 }
 
 
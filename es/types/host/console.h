@@ -15,7 +15,7 @@ class Console : public JSObject {
     return singleton;
   }
 
-  static Handle<JSValue> log(Handle<Error>& e, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> vals) {
+  static Handle<JSValue> log(Handle<Error>& e, Handle<JSValue> this_arg, Span<Handle<JSValue>> vals) {
     std::vector<std::string> strs;
     for (size_t i = 0; i < vals.size(); ++i) {
       if (i != 0)
@@ -4,6 +4,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 #include <vector>
 #include <map>
 
@@ -14,10 +15,11 @@
 #include <es/error.h>
 #include <es/utils/helper.h>
 #include <es/utils/property_map.h>
+#include <es/utils/span.h>
 
 namespace es {
 
-typedef Handle<JSValue> (*inner_func)(Handle<Error>&, Handle<JSValue>, std::vector<Handle<JSValue>>);
+typedef Handle<JSValue> (*inner_func)(Handle<Error>&, Handle<JSValue>, Span<Handle<JSValue>>);
 
 class JSObject : public JSValue {
  public:
@@ -37,11 +39,8 @@ class JSObject : public JSValue {
     if (unlikely(log::Debugger::On()))
       std::cout << "JSObject::New " << log::ToString(klass) << "\n";
 #endif
-    Handle<JSValue> jsval = HeapObject::New<flag>(kJSObjectOffset - kJSValueOffset + size);
-    // NOTE(zhuzilin) We need to put the operation that may need memory allocation to
-    // the front, because the jsval is not initialized with JSObject vptr and therefore
-    // could not forward the pointers.
-    auto property_map = PropertyMap::New(property_map_num_fixed_slots, property_map_hashmap_capacity);
+    Handle<JSValue> jsval = HeapObject::New<flag>(
+      kJSObjectOffset - kJSValueOffset + size + property_map_num_fixed_slots * sizeof(PropertyMap::Slot));
 
     jsval.val()->h_.klass = klass;
     jsval.val()->h_.extensible = extensible;
@@ -56,7 +55,10 @@ class JSObject : public JSValue {
       TYPED_PTR(jsval.val(), kCallableOffset, inner_func)[0] = callable;
     }
     SET_HANDLE_VALUE(jsval.val(), kPrototypeOffset, Null::Instance(), JSValue);
-    SET_HANDLE_VALUE(jsval.val(), kNamedPropertiesOffset, property_map, PropertyMap);
+    // The fixed slots are after the fields of the subclass.
+    TYPED_PTR(jsval.val(), kNamedPropertiesOffset, PropertyMap)->Init(
+      property_map_num_fixed_slots, kJSObjectOffset + size - kNamedPropertiesOffset,
+      property_map_hashmap_capacity);
 
     jsval.val()->SetType(JS_OBJECT);
     return Handle<JSObject>(jsval);
@@ -77,11 +79,10 @@ class JSObject : public JSValue {
     if (unlikely(log::Debugger::On()))
       std::cout << "JSObject::New " << log::ToString(klass) << "\n";
 #endif
-    Handle<JSValue> jsval = HeapObject::New<kJSObjectOffset - kJSValueOffset + size, flag>();
-    // NOTE(zhuzilin) We need to put the operation that may need memory allocation to
-    // the front, because the jsval is not initialized with JSObject vptr and therefore
-    // could not forward the pointers.
-    auto property_map = PropertyMap::New(property_map_num_fixed_slots, property_map_hashmap_capacity);
+    Handle<JSValue> jsval = property_map_num_fixed_slots == 0 ?
+      HeapObject::New<kJSObjectOffset - kJSValueOffset + size, flag>() :
+      HeapObject::New<flag>(
+        kJSObjectOffset - kJSValueOffset + size + property_map_num_fixed_slots * sizeof(PropertyMap::Slot));
 
     jsval.val()->h_.klass = klass;
     jsval.val()->h_.extensible = extensible;
@@ -96,20 +97,27 @@ class JSObject : public JSValue {
       TYPED_PTR(jsval.val(), kCallableOffset, inner_func)[0] = callable;
     }
     SET_HANDLE_VALUE(jsval.val(), kPrototypeOffset, Null::Instance(), JSValue);
-    SET_HANDLE_VALUE(jsval.val(), kNamedPropertiesOffset, property_map, PropertyMap);
+    // The fixed slots are after the fields of the subclass.
+    TYPED_PTR(jsval.val(), kNamedPropertiesOffset, PropertyMap)->Init(
+      property_map_num_fixed_slots, kJSObjectOffset + size - kNamedPropertiesOffset,
+      property_map_hashmap_capacity);
 
     jsval.val()->SetType(JS_OBJECT);
     return Handle<JSObject>(jsval);
   }
 
   PropertyMap* named_properties() {
-    return READ_VALUE(this, kNamedPropertiesOffset, PropertyMap*);
+    return TYPED_PTR(this, kNamedPropertiesOffset, PropertyMap);
   };
 
   // Internal Preperties Common to All Objects
   Handle<JSValue> Prototype() { return READ_HANDLE_VALUE(this, kPrototypeOffset, JSValue); }
   void SetPrototype(Handle<JSValue> proto) {
     ASSERT(proto.val()->IsPrototype());
+    if (named_properties()->is_prototype())
+      PrototypeLookupCache::Invalidate();
+    if (proto.val()->IsObject())
+      static_cast<JSObject*>(proto.val())->named_properties()->set_is_prototype();
     SET_HANDLE_VALUE(this, kPrototypeOffset, proto, JSValue);
   }
   ClassType Class() { return h_.klass; };
@@ -132,30 +140,62 @@ class JSObject : public JSValue {
     return TYPED_PTR(this, kCallableOffset, inner_func)[0];
   }
 
-  // This for for-in statement.
+  // For Object.keys.
+  std::vector<Handle<String>> OwnEnumerableKeys() {
+    return named_properties()->Keys([](auto* p) { return IsEnumerable(p); });
+  }
+
+  // This for for-in statement. Walk the prototype chain once, a key is
+  // skipped if it is shadowed by a property seen before, even when that
+  // property is not enumerable.
   std::vector<Handle<String>> AllEnumerableKeys() {
-    auto desc_filter = [](PropertyDescriptor* desc) -> bool {
-      return desc->HasEnumerable() && desc->Enumerable();
-    };
-    auto entry_filter = [](HashMapV2::Entry* p) -> bool {
-      if (p->val->IsPropertyDescriptor()) {
-        auto desc = static_cast<PropertyDescriptor*>(p->val);
-        return desc->HasEnumerable() && desc->Enumerable();
-      }
-      return p->has_enumerable && p->enumerable;
-    };
-    std::vector<Handle<String>> result = named_properties()->SortedKeys(desc_filter, entry_filter);
-    if (!Prototype().val()->IsNull()) {
-      Handle<JSObject> proto = static_cast<Handle<JSObject>>(Prototype());
-      for (auto key : proto.val()->AllEnumerableKeys()) {
-        if (named_properties()->Get(key).IsUndefined()) {
+    if (Prototype().val()->IsNull())
+      return OwnEnumerableKeys();
+    std::vector<Handle<String>> result;
+    std::unordered_set<String*, StringHasher, StringEqualer> seen;
+    // No heap allocation below, so raw pointers are fine.
+    JSObject* obj = this;
+    while (true) {
+      obj->named_properties()->ForEach([&](Handle<String> key, auto* p) {
+        if (seen.insert(key.val()).second && IsEnumerable(p))
           result.emplace_back(key);
+      });
+      // The properties that are not created yet still shadow.
+      if (obj->named_properties()->has_pending_properties()) {
+        if (obj->IsErrorObject()) {
+          seen.insert(String::message().val());
+        } else {
+          seen.insert(String::Length().val());
+          seen.insert(String::Prototype().val());
         }
       }
+      JSValue* proto = obj->Prototype().val();
+      if (proto->IsNull())
+        break;
+      obj = static_cast<JSObject*>(proto);
     }
     return result;
   }
 
+  // The keys visited by the for-in statement. When no prototype has
+  // enumerable keys, which is the common case, the result is just the
+  // cached own keys. The chain is checked every time, so changing a
+  // prototype needs no invalidation.
+  static Handle<FixedArray> ForInKeys(Handle<JSObject> O) {
+    if (O.val()->named_properties()->num_fixed_slots() == 0) {
+      bool inherits_keys = false;
+      JSValue* proto = O.val()->Prototype().val();
+      while (!proto->IsNull() && !inherits_keys) {
+        JSObject* proto_obj = static_cast<JSObject*>(proto);
+        inherits_keys = proto_obj->named_properties()->HasEnumerableKeys();
+        proto = proto_obj->Prototype().val();
+      }
+      if (!inherits_keys)
+        return PropertyMap::EnumerableKeys(O);
+    }
+    return FixedArray::New(O.val()->AllEnumerableKeys());
+  }
+
  public:
   // primitive value and offset are saved together.
   static constexpr size_t kPrimitiveValueOffset = kJSValueOffset;
@@ -163,7 +203,7 @@ class JSObject : public JSValue {
 
   static constexpr size_t kPrototypeOffset = kCallableOffset + kFuncPtrSize;
   static constexpr size_t kNamedPropertiesOffset = kPrototypeOffset + kPtrSize;
-  static constexpr size_t kJSObjectOffset = kNamedPropertiesOffset + kPtrSize;
+  static constexpr size_t kJSObjectOffset = kNamedPropertiesOffset + sizeof(PropertyMap);
 };
 
 Handle<JSValue> Get(Handle<Error>& e, Handle<JSObject> O, Handle<String> P);
@@ -200,11 +240,11 @@ void AddFuncProperty(
   bool enumerable, bool configurable
 );
 
-Handle<JSValue> Call(Handle<Error>& e, Handle<JSValue> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSValue> Call__Base(Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
-Handle<JSValue> Call__Construct(Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, std::vector<Handle<JSValue>> arguments = {});
+Handle<JSValue> Call(Handle<Error>& e, Handle<JSValue> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSValue> Call__Base(Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
+Handle<JSValue> Call__Construct(Handle<Error>& e, Handle<JSObject> O, Handle<JSValue> this_arg, Span<Handle<JSValue>> arguments = {});
 
-Handle<JSObject> Construct(Handle<Error>& e, Handle<JSObject> O, std::vector<Handle<JSValue>> arguments);
+Handle<JSObject> Construct(Handle<Error>& e, Handle<JSObject> O, Span<Handle<JSValue>> arguments);
 
 bool UpdateOwnProperty(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag);
 bool UpdateOwnProperty__ArrayObject(Handle<Error>& e, Handle<JSObject> O, Handle<String> P, Handle<JSValue> V, bool throw_flag);
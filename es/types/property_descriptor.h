@@ -190,139 +190,41 @@ class StackPropertyDescriptor {
   bool is_undefined_;
 };
 
-class PropertyDescriptor : public JSValue {
+// The getter and setter of an accessor property. The enumerable and
+// configurable attributes are kept inline in the property map next to the
+// pointer to the pair, like the attributes of data properties.
+class AccessorPair : public JSValue {
  public:
-  static Handle<PropertyDescriptor> New() {
-    Handle<JSValue> jsval = HeapObject::New<kDescSize - kJSValueOffset>();
+  static Handle<AccessorPair> New(StackPropertyDescriptor desc) {
+    ASSERT(desc.IsAccessorDescriptor());
+    Handle<JSValue> jsval = HeapObject::New<kAccessorPairSize - kJSValueOffset>();
 
-    jsval.val()->SetBitMask(0);
-
-    jsval.val()->SetType(JS_PROP_DESC);
-    return Handle<PropertyDescriptor>(jsval);
-  }
-
-  static Handle<PropertyDescriptor> NewDataDescriptor(
-    Handle<JSValue> value, bool writable, bool enumerable, bool configurable
-  ) {
-    Handle<JSValue> jsval = HeapObject::New<kDescSize - kJSValueOffset>();
-
-    char bitmask = VALUE | WRITABLE | ENUMERABLE | CONFIGURABLE;
-    if (enumerable) bitmask |= ENUMERABLE_V;
-    if (configurable) bitmask |= CONFIGURABLE_V;
+    char bitmask = 0;
+    if (desc.HasGet()) bitmask |= GET;
+    if (desc.HasSet()) bitmask |= SET;
     jsval.val()->SetBitMask(bitmask);
-    SET_HANDLE_VALUE(jsval.val(), kValueOffset, value, JSValue);
-    SET_VALUE(jsval.val(), kWritableOffset, writable, bool);
-
-    jsval.val()->SetType(JS_PROP_DESC);
-    return Handle<PropertyDescriptor>(jsval);
-  }
-
-  inline bool IsAccessorDescriptor() {
-    return (bitmask() & (GET | SET)) != 0;
-  }
-
-  inline bool IsDataDescriptor() {
-    return (bitmask() & (VALUE | WRITABLE)) != 0;
-  }
+    SET_HANDLE_VALUE(jsval.val(), kGetOffset, desc.Get(), JSValue);
+    SET_HANDLE_VALUE(jsval.val(), kSetOffset, desc.Set(), JSValue);
 
-  inline bool IsGenericDescriptor() {
-    return !IsAccessorDescriptor() && !IsDataDescriptor();
-  }
-
-  // TODO(zhuzilin) May be check the member variable is initialized?
-  inline bool HasValue() { return bitmask() & VALUE; }
-  inline Handle<JSValue> Value() { return READ_HANDLE_VALUE(this, kValueOffset, JSValue); }
-  inline void SetValue(Handle<JSValue> value) {
-    SetBitMask(bitmask() | VALUE);
-    SET_HANDLE_VALUE(this, kValueOffset, value, JSValue);
-  }
-
-  inline bool HasWritable() {return bitmask() & WRITABLE; }
-  inline bool Writable() { return READ_VALUE(this, kWritableOffset, bool); }
-  inline void SetWritable(bool writable) {
-    SetBitMask(bitmask() | WRITABLE);
-    SET_VALUE(this, kWritableOffset, writable, bool);
+    jsval.val()->SetType(JS_ACCESSOR_PAIR);
+    return Handle<AccessorPair>(jsval);
   }
 
-  inline bool HasGet() {return bitmask() & GET; }
+  inline bool HasGet() { return bitmask() & GET; }
   inline Handle<JSValue> Get() { return READ_HANDLE_VALUE(this, kGetOffset, JSValue); }
-  inline void SetGet(Handle<JSValue> getter) {
-    SetBitMask(bitmask() | GET);
-    SET_HANDLE_VALUE(this, kGetOffset, getter, JSValue);
-  }
 
   inline bool HasSet() { return bitmask() & SET; }
   inline Handle<JSValue> Set() { return READ_HANDLE_VALUE(this, kSetOffset, JSValue); }
-  inline void SetSet(Handle<JSValue> setter) {
-    SetBitMask(bitmask() | SET);
-    SET_HANDLE_VALUE(this, kSetOffset, setter, JSValue);
-  }
-
-  inline bool HasEnumerable() { return bitmask() & ENUMERABLE; }
-  inline bool Enumerable() { return bitmask() & ENUMERABLE_V; }
-  inline void SetEnumerable(bool enumerable) {
-    SetBitMask(bitmask() | ENUMERABLE | (enumerable ? ENUMERABLE_V : 0));
-  }
-
-  inline bool HasConfigurable() { return bitmask() & CONFIGURABLE; }
-  inline bool Configurable() { return bitmask() & CONFIGURABLE_V; }
-  inline void SetConfigurable(bool configurable) {
-    SetBitMask(bitmask() | CONFIGURABLE | (configurable ? CONFIGURABLE_V : 0));
-  }
-
-  inline void SetDataDescriptor(
-    Handle<JSValue> value, bool writable, bool enumerable, bool configurable
-  ) {
-    SetValue(value);
-    SetWritable(writable);
-    SetEnumerable(enumerable);
-    SetConfigurable(configurable);
-  }
-
-  inline void SetAccessorDescriptor(
-    Handle<JSValue> getter, Handle<JSValue> setter, bool enumerable, bool configurable
-  ) {
-    SetGet(getter);
-    SetSet(setter);
-    SetEnumerable(enumerable);
-    SetConfigurable(configurable);
-  }
-
-  // Set the value to `this` if `other` has.
-  inline void Set(Handle<PropertyDescriptor> other) {
-    if (other.val()->HasValue())
-      SetValue(other.val()->Value());
-    if (other.val()->HasWritable())
-      SetWritable(other.val()->Writable());
-    if (other.val()->HasGet())
-      SetGet(other.val()->Get());
-    if (other.val()->HasSet())
-      SetSet(other.val()->Set());
-    if (other.val()->HasConfigurable())
-      SetConfigurable(other.val()->Configurable());
-    if (other.val()->HasEnumerable())
-      SetEnumerable(other.val()->Enumerable());
-  }
 
  public:
   static constexpr size_t kGetOffset = kJSValueOffset;
   static constexpr size_t kSetOffset = kGetOffset + kPtrSize;
-
-  static constexpr size_t kValueOffset = kJSValueOffset;
-  static constexpr size_t kWritableOffset = kValueOffset + kPtrSize;
-
-  static constexpr size_t kDescSize = kSetOffset + kPtrSize;
+  static constexpr size_t kAccessorPairSize = kSetOffset + kPtrSize;
 
  private:
   enum Field : uint8_t {
-    VALUE          = 1 << 0,
-    WRITABLE       = 1 << 1,
-    GET            = 1 << 2,
-    SET            = 1 << 3,
-    ENUMERABLE     = 1 << 4,
-    CONFIGURABLE   = 1 << 5,
-    ENUMERABLE_V   = 1 << 6,
-    CONFIGURABLE_V = 1 << 7,
+    GET = 1 << 0,
+    SET = 1 << 1,
   };
 };
 
@@ -52,7 +52,7 @@ enum Type : uint16_t {
 
   SPEC_TYPE = 1 << 8,
 
-  JS_PROP_DESC    = 1 << 8 | 2,
+  JS_ACCESSOR_PAIR = 1 << 8 | 2,
   JS_ENV_REC_DECL = 1 << 8 | 3,
   JS_ENV_REC_OBJ  = 1 << 8 | 4,
   JS_GET_SET      = 1 << 8 | 5,
@@ -64,7 +64,6 @@ enum Type : uint16_t {
   HASHMAP     = 1 << 10 | 3,
   HASHMAP_V2  = 1 << 10 | 4,
   LIST_NODE   = 1 << 10 | 5,
-  PROPERTY_MAP = 1 << 10 | 6,
 };
 
 enum ClassType : uint8_t {
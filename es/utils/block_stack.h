@@ -3,6 +3,9 @@
 
 #include <stdlib.h>
 
+#include <memory>
+#include <vector>
+
 namespace es {
 
 template<typename T, size_t N>
@@ -0,0 +1,197 @@
+#ifndef ES_UTILS_DOUBLE_CONVERSION_H
+#define ES_UTILS_DOUBLE_CONVERSION_H
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <string>
+
+#include <es/utils/macros.h>
+
+namespace es {
+
+// Enough for "-1.2345678901234567e-308".
+constexpr size_t kMaxDoubleCharsSize = 32;
+
+// 9.8.1 ToString Applied to the Number Type
+// Write the representation of m to buf and return the length. The digits
+// come from std::to_chars, which produces the shortest string that round
+// trips (Ryu in libstdc++), i.e. the k in step 5 is as small as possible.
+template<typename CharT>
+size_t DoubleToChars(double m, CharT* buf) {
+  if (isnan(m)) {
+    const char* nan = "NaN";
+    for (size_t i = 0; i < 3; ++i)
+      buf[i] = nan[i];
+    return 3;
+  }
+  size_t pos = 0;
+  if (m == 0) {
+    buf[pos++] = '0';
+    return pos;
+  }
+  if (m < 0) {
+    buf[pos++] = '-';
+    m = -m;
+  }
+  if (isinf(m)) {
+    const char* infinity = "Infinity";
+    for (size_t i = 0; i < 8; ++i)
+      buf[pos++] = infinity[i];
+    return pos;
+  }
+
+  // e.g. "1.2345e+02"
+  char sci[kMaxDoubleCharsSize];
+  char* end = std::to_chars(sci, sci + kMaxDoubleCharsSize - 1, m, std::chars_format::scientific).ptr;
+  *end = '\0';
+  char digits[kMaxDoubleCharsSize] = {};
+  int k = 0;
+  char* p = sci;
+  for (; p < end && *p != 'e'; ++p) {
+    if (*p != '.')
+      digits[k++] = *p;
+  }
+  int n = atoi(p + 1) + 1;
+
+  if (k <= n && n <= 21) {
+    for (int i = 0; i < k; ++i)
+      buf[pos++] = digits[i];
+    for (int i = k; i < n; ++i)
+      buf[pos++] = '0';
+    return pos;
+  }
+  if (0 < n && n <= 21) {
+    for (int i = 0; i < k; ++i) {
+      if (i == n)
+        buf[pos++] = '.';
+      buf[pos++] = digits[i];
+    }
+    return pos;
+  }
+  if (-6 < n && n <= 0) {
+    buf[pos++] = '0';
+    buf[pos++] = '.';
+    for (int i = 0; i < -n; ++i)
+      buf[pos++] = '0';
+    for (int i = 0; i < k; ++i)
+      buf[pos++] = digits[i];
+    return pos;
+  }
+  buf[pos++] = digits[0];
+  if (k > 1) {
+    buf[pos++] = '.';
+    for (int i = 1; i < k; ++i)
+      buf[pos++] = digits[i];
+  }
+  buf[pos++] = 'e';
+  buf[pos++] = n - 1 > 0 ? '+' : '-';
+  int exp = n - 1 > 0 ? n - 1 : 1 - n;
+  char exp_digits[4];
+  int num_exp_digits = 0;
+  do {
+    exp_digits[num_exp_digits++] = '0' + exp % 10;
+    exp /= 10;
+  } while (exp);
+  while (num_exp_digits)
+    buf[pos++] = exp_digits[--num_exp_digits];
+  return pos;
+}
+
+// Parse StrUnsignedDecimalLiteral (without Infinity). Return NaN if the
+// whole buffer is not one. The digits are handed to std::from_chars,
+// which is correctly rounded (Eisel-Lemire in libstdc++).
+template<typename CharT>
+double UnsignedDecimalCharsToDouble(const CharT* s, size_t n) {
+  size_t i = 0;
+  size_t num_digits = 0;
+  while (i < n && '0' <= s[i] && s[i] <= '9') {
+    i++;
+    num_digits++;
+  }
+  if (i < n && s[i] == '.') {
+    i++;
+    while (i < n && '0' <= s[i] && s[i] <= '9') {
+      i++;
+      num_digits++;
+    }
+  }
+  if (num_digits == 0)
+    return nan("");
+  if (i < n && (s[i] == 'e' || s[i] == 'E')) {
+    i++;
+    if (i < n && (s[i] == '+' || s[i] == '-'))
+      i++;
+    size_t exp_start = i;
+    while (i < n && '0' <= s[i] && s[i] <= '9')
+      i++;
+    if (i == exp_start)
+      return nan("");
+  }
+  if (i != n)
+    return nan("");
+
+  char stack_buf[64];
+  std::string heap_buf;
+  char* buf = stack_buf;
+  if (n >= sizeof(stack_buf)) {
+    heap_buf.resize(n + 1);
+    buf = heap_buf.data();
+  }
+  for (size_t j = 0; j < n; ++j)
+    buf[j] = static_cast<char>(s[j]);
+  buf[n] = '\0';
+  double val = 0;
+  auto res = std::from_chars(buf, buf + n, val);
+  if (unlikely(res.ec == std::errc::result_out_of_range)) {
+    // from_chars leaves val untouched on overflow and underflow.
+    val = strtod(buf, nullptr);
+  }
+  return val;
+}
+
+// 9.3.1 ToNumber Applied to the String Type, on a buffer with the
+// white spaces already trimmed.
+template<typename CharT>
+double CharsToDouble(const CharT* s, size_t n) {
+  // The MV of [empty] is 0
+  if (n == 0)
+    return 0;
+  if (n > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+    double val = 0;
+    for (size_t i = 2; i < n; ++i) {
+      CharT c = s[i];
+      int digit;
+      if ('0' <= c && c <= '9')
+        digit = c - '0';
+      else if ('a' <= c && c <= 'f')
+        digit = c - 'a' + 10;
+      else if ('A' <= c && c <= 'F')
+        digit = c - 'A' + 10;
+      else
+        return nan("");
+      val = val * 16 + digit;
+    }
+    return val;
+  }
+  bool positive = true;
+  if (s[0] == '-' || s[0] == '+') {
+    positive = s[0] == '+';
+    s++;
+    n--;
+  }
+  double val;
+  const char* infinity = "Infinity";
+  if (n == 8 && std::equal(s, s + n, infinity))
+    val = std::numeric_limits<double>::infinity();
+  else
+    val = UnsignedDecimalCharsToDouble(s, n);
+  return positive ? val : -val;
+}
+
+}  // namespace es
+
+#endif  // ES_UTILS_DOUBLE_CONVERSION_H
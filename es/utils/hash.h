@@ -0,0 +1,98 @@
+#ifndef ES_UTILS_HASH_H
+#define ES_UTILS_HASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <es/utils/macros.h>
+
+namespace es {
+namespace hash {
+
+// The wyhash (final version 4) by Wang Yi, which is released into the
+// public domain. It only reads the input in place, so the string does not
+// need to be copied out of the heap to be hashed.
+// https://github.com/wangyi-fudan/wyhash
+
+constexpr uint64_t kSecret0 = 0xa0761d6478bd642full;
+constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbull;
+constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ull;
+constexpr uint64_t kSecret3 = 0x589965cc75374cc3ull;
+
+inline void Multiply(uint64_t& a, uint64_t& b) {
+  __uint128_t r = a;
+  r *= b;
+  a = static_cast<uint64_t>(r);
+  b = static_cast<uint64_t>(r >> 64);
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b) {
+  Multiply(a, b);
+  return a ^ b;
+}
+
+inline uint64_t Read8(const uint8_t* p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+inline uint64_t Read4(const uint8_t* p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+inline uint64_t WyHash(const void* key, size_t len, uint64_t seed = 0) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(key);
+  seed ^= Mix(seed ^ kSecret0, kSecret1);
+  uint64_t a, b;
+  if (likely(len <= 16)) {
+    if (likely(len >= 4)) {
+      a = (Read4(p) << 32) | Read4(p + ((len >> 3) << 2));
+      b = (Read4(p + len - 4) << 32) | Read4(p + len - 4 - ((len >> 3) << 2));
+    } else if (likely(len > 0)) {
+      a = (uint64_t(p[0]) << 16) | (uint64_t(p[len >> 1]) << 8) | p[len - 1];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t i = len;
+    if (unlikely(i > 48)) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = Mix(Read8(p) ^ kSecret1, Read8(p + 8) ^ seed);
+        see1 = Mix(Read8(p + 16) ^ kSecret2, Read8(p + 24) ^ see1);
+        see2 = Mix(Read8(p + 32) ^ kSecret3, Read8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (likely(i > 48));
+      seed ^= see1 ^ see2;
+    }
+    while (unlikely(i > 16)) {
+      seed = Mix(Read8(p) ^ kSecret1, Read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Read8(p + i - 16);
+    b = Read8(p + i - 8);
+  }
+  a ^= kSecret1;
+  b ^= seed;
+  Multiply(a, b);
+  return Mix(a ^ kSecret0 ^ len, b ^ kSecret1);
+}
+
+// Hash of a utf-16 buffer folded into 32 bits. Never returns 0 so that
+// 0 could be used to mark a hash that has not been computed.
+inline uint32_t U16Hash(const char16_t* data, size_t n) {
+  uint64_t h = WyHash(data, n * sizeof(char16_t));
+  uint32_t hash = static_cast<uint32_t>(h ^ (h >> 32));
+  return hash ? hash : 1;
+}
+
+}  // namespace hash
+}  // namespace es
+
+#endif  // ES_UTILS_HASH_H
@@ -1,11 +1,15 @@
 #ifndef ES_UTILS_HASHMAP_V2_H
 #define ES_UTILS_HASHMAP_V2_H
 
-#include <queue>
 #include <unordered_map>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <es/gc/heap_object.h>
 #include <es/types/base.h>
+#include <es/utils/fixed_array.h>
 
 namespace es {
 
@@ -27,7 +31,42 @@ uint32_t NextPowerOf2(uint32_t v) {
   return v;
 }
 
+// A group of 16 control bytes, which are compared at once.
+struct ControlGroup {
+  static constexpr uint32_t kWidth = 16;
+
+#if defined(__SSE2__)
+  explicit ControlGroup(const uint8_t* p) :
+    ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+  uint32_t Match(uint8_t c) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(c)));
+  }
+
+  __m128i ctrl;
+#else
+  explicit ControlGroup(const uint8_t* p) : ctrl(p) {}
+
+  uint32_t Match(uint8_t c) const {
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < kWidth; ++i) {
+      if (ctrl[i] == c)
+        mask |= 1u << i;
+    }
+    return mask;
+  }
+
+  const uint8_t* ctrl;
+#endif
+};
+
 // NOTE(zhuzilin) For now, the key type will be String*.
+// An open addressing hash map in the style of swiss table. The entries are
+// kept in a dense array in the order of insertion, and each slot of the
+// table has a control byte and the index of its entry. The control byte is
+// either empty, deleted or the lowest 7 bits of the hash. The control bytes
+// are probed a group at a time, so that most of the misses will not touch
+// the entries.
 class HashMapV2 : public JSValue {
  public:
   struct Entry {
@@ -57,64 +96,45 @@ class HashMapV2 : public JSValue {
   static void DoNothing(Entry* entry) {}
   static JSValue* ReturnValue(Entry* entry) { return entry->val; }
 
-  template<size_t kDefaultHashMapSize = 4>
+  template<size_t kDefaultHashMapSize = 4, flag_t flag = 0>
   static Handle<HashMapV2> New(size_t guessed_occupancy = 0) {
-#ifdef GC_DEBUG
-    if (unlikely(log::Debugger::On()))
-      std::cout << "HashMapV2::New" << "\n";
-#endif
-    size_t capacity = NextPowerOf2(guessed_occupancy + guessed_occupancy / 4 + 1);
+    size_t capacity = NextPowerOf2(guessed_occupancy * 8 / 7 + 1);
     if (capacity < kDefaultHashMapSize)
       capacity = kDefaultHashMapSize;
-    assert(IsPowerOf2(capacity));
-
-    if (ExtracGC::resize_released_maps[capacity].size()) {
-      // no memory allocation
-      Handle<HashMapV2> jsval(ExtracGC::resize_released_maps[capacity].top());
-      ExtracGC::resize_released_maps[capacity].pop();
-      jsval.val()->Clear();
-      return jsval;
-    }
-
-    Handle<HashMapV2> jsval = HeapObject::New(kElementOffset + capacity * sizeof(Entry) - HeapObject::kHeapObjectOffset);
-
-    SET_VALUE(jsval.val(), kCapacityOffset, capacity, uint32_t);
-
-    jsval.val()->SetType(HASHMAP_V2);
-    // do not need to set to 0 as the heap is already 0ed.
-    //jsval.val()->Clear();
-    return jsval;
+    return NewWithCapacity<flag>(capacity);
   }
 
   uint32_t occupancy() { return READ_VALUE(this, kOccupancyOffset, uint32_t); }
   void set_occupancy(size_t s) { SET_VALUE(this, kOccupancyOffset, s, uint32_t); }
   uint32_t capacity() { return READ_VALUE(this, kCapacityOffset, uint32_t); }
+  // Number of entries appended, including the deleted ones.
+  uint32_t num_used() { return READ_VALUE(this, kNumUsedOffset, uint32_t); }
+  void set_num_used(size_t s) { SET_VALUE(this, kNumUsedOffset, s, uint32_t); }
 
-  Entry* map_start() { return TYPED_PTR(this, kElementOffset, Entry); }
-  const Entry* map_end() { return TYPED_PTR(this, kElementOffset, Entry) + capacity(); }
+  uint8_t* control() { return TYPED_PTR(this, kControlOffset, uint8_t); }
+  uint32_t* index() { return TYPED_PTR(this, IndexOffset(capacity()), uint32_t); }
+  Entry* map_start() { return TYPED_PTR(this, EntryOffset(capacity()), Entry); }
+  const Entry* map_end() { return map_start() + num_used(); }
+
+  // The enumerable keys cached by PropertyMap, dropped whenever an entry is
+  // added, redefined or deleted.
+  FixedArray* enum_cache() { return READ_VALUE(this, kEnumCacheOffset, FixedArray*); }
+  void set_enum_cache(FixedArray* keys) { SET_VALUE(this, kEnumCacheOffset, keys, FixedArray*); }
 
   // Set can not be method as there can be gc happening inside.
   template<typename EntryFn = decltype(DoNothing)>
   static Handle<HashMapV2> Set(
     Handle<HashMapV2> map, Handle<String> key, Handle<JSValue> val, EntryFn entry_fn = DoNothing
   ) {
-    if (map.val()->occupancy() + map.val()->occupancy() / 4 + 1 >= map.val()->capacity()) {
-      Handle<HashMapV2> new_map = Resize(map);
-      ExtracGC::resize_released_maps[map.val()->capacity()].push(map.val());
-      map = new_map;
-    }
+    map = ReserveOne(map);
 
     // There will not be any new memory allocated after this line.
     // So we could use pointer.
-    uint32_t hash = key.val()->Hash();
-    Entry* p = map.val()->Probe(key.val(), hash);
-    if (p->is_empty()) {
-      map.val()->set_occupancy(map.val()->occupancy() + 1);
-      p->key = key.val();
-    }
-    p->hash = hash;
+    bool created;
+    Entry* p = map.val()->FindOrInsert(key.val(), key.val()->Hash(), created);
     p->val = val.val();
     entry_fn(p);
+    map.val()->set_enum_cache(nullptr);
     return map;
   }
 
@@ -123,51 +143,27 @@ class HashMapV2 : public JSValue {
   static Handle<HashMapV2> Create(
     Handle<HashMapV2> map, Handle<String> key, Handle<JSValue> val, bool& created, EntryFn entry_fn = DoNothing
   ) {
-    if (map.val()->occupancy() + map.val()->occupancy() / 4 + 1 >= map.val()->capacity()) {
-      Handle<HashMapV2> new_map = Resize(map);
-      ExtracGC::resize_released_maps[map.val()->capacity()].push(map.val());
-      map = new_map;
-    }
+    map = ReserveOne(map);
 
     // There will not be any new memory allocated after this line.
     // So we could use pointer.
-    uint32_t hash = key.val()->Hash();
-    Entry* p = map.val()->Probe(key.val(), hash);
+    Entry* p = map.val()->FindOrInsert(key.val(), key.val()->Hash(), created);
     // return when exists one.
-    created = p->is_empty();
-    if (!p->is_empty())
+    if (!created)
       return map;
 
-    if (p->is_empty()) {
-      map.val()->set_occupancy(map.val()->occupancy() + 1);
-      p->key = key.val();
-    }
-    p->hash = hash;
     p->val = val.val();
     entry_fn(p);
+    map.val()->set_enum_cache(nullptr);
     return map;
   }
 
-  HashMapV2::Entry* Probe(String* key, uint32_t hash) {
-    ASSERT(key != NULL);
-    size_t cap = capacity();
-    Entry* map = map_start();
-    const Entry* end = map_end();
-    Entry* p = map + (hash & (cap - 1));
-    ASSERT(map <= p && p < end);
-
-#ifdef TEST
-    size_t occ = occupancy();
-    ASSERT(occ < cap);
-#endif
-    while (!p->is_empty() && (hash != p->hash || !StringEqual(key, p->key))) {
-      p++;
-      if (p >= end) {
-        p = map;
-      }
-    }
-
-    return p;
+  // Return the entry of key, or nullptr if there is none.
+  Entry* Find(String* key, uint32_t hash) {
+    uint32_t slot = FindSlot(key, hash);
+    if (slot == kNotFound)
+      return nullptr;
+    return map_start() + index()[slot];
   }
 
   Handle<JSValue> Get(Handle<String> key) {
@@ -176,149 +172,210 @@ class HashMapV2 : public JSValue {
 
   template<typename EntryFn = decltype(DoNothing)>
   JSValue* GetRaw(Handle<String> key, EntryFn entry_fn = DoNothing) {
-    uint32_t hash = key.val()->Hash();
-    Entry* p = Probe(key.val(), hash);
-    if (p->is_empty())
+    Entry* p = Find(key.val(), key.val()->Hash());
+    if (p == nullptr)
       return nullptr;
     entry_fn(p);
     return p->val;
   }
 
   Entry* GetEntry(Handle<String> key) {
-    uint32_t hash = key.val()->Hash();
-    Entry* p = Probe(key.val(), hash);
-    if (p->is_empty())
-      return nullptr;
-    return p;
+    return Find(key.val(), key.val()->Hash());
   }
 
+  // The entry is left as a hole in the dense array, which will be
+  // compacted in the next resize.
   void Delete(Handle<String> key) {
-    uint32_t hash = key.val()->Hash();
-    Entry* p = Probe(key.val(), hash);
-    if (p->is_empty())
+    uint32_t slot = FindSlot(key.val(), key.val()->Hash());
+    if (slot == kNotFound)
       return;
+    uint8_t* ctrl = control();
+    // If the group still has an empty slot, it has never been full, so no
+    // probe has ever passed it and the slot could be empty again.
+    // Otherwise leave a tombstone to keep the probes going.
+    ControlGroup group(ctrl + slot / ControlGroup::kWidth * ControlGroup::kWidth);
+    ctrl[slot] = (group.Match(kEmpty) & ValidMask()) ? kEmpty : kDeleted;
+    map_start()[index()[slot]].key = NULL;
+    set_occupancy(occupancy() - 1);
+    set_enum_cache(nullptr);
+  }
 
-    Entry* map = map_start();
-    const Entry* end = map_end();
-    uint32_t cap = capacity();
-
-    // The following is from v8.
-
-    // To remove an entry we need to ensure that it does not create an empty
-    // entry that will cause the search for another entry to stop too soon. If all
-    // the entries between the entry to remove and the next empty slot have their
-    // initial position inside this interval, clearing the entry to remove will
-    // not break the search. If, while searching for the next empty entry, an
-    // entry is encountered which does not have its initial position between the
-    // entry to remove and the position looked at, then this entry can be moved to
-    // the place of the entry to remove without breaking the search for it. The
-    // entry made vacant by this move is now the entry to remove and the process
-    // starts over.
-    // Algorithm from http://en.wikipedia.org/wiki/Open_addressing.
-
-    // This guarantees loop termination as there is at least one empty entry so
-    // eventually the removed entry will have an empty entry after it.
-    ASSERT(occupancy() < capacity());
-
-    // p is the candidate entry to clear. q is used to scan forwards.
-    Entry* q = p;  // Start at the entry to remove.
-    while (true) {
-      // Move q to the next entry.
-      q = q + 1;
-      if (q == end) {
-        q = map;
+  // Return the keys in the order of insertion.
+  template<typename Filter>
+  std::vector<Handle<String>> Keys(Filter filter) {
+    std::vector<Handle<String>> result;
+    for (Entry* p = map_start(); p < map_end(); ++p) {
+      if (!p->is_empty() && filter(p)) {
+        result.emplace_back(p->key);
       }
+    }
+    return result;
+  }
 
-      // All entries between p and q have their initial position between p and q
-      // and the entry p can be cleared without breaking the search for these
-      // entries.
-      if (q->key == NULL) {
-        break;
-      }
+  void Clear() {
+    memset(PTR(this, kOccupancyOffset), 0, MapSize(capacity()) - kOccupancyOffset);
+  }
 
-      // Find the initial position for the entry at position q.
-      Entry* r = map + (q->hash & (cap - 1));
+  // Make this map a copy of `other`, which has the same capacity.
+  void CopyFrom(HashMapV2* other) {
+    ASSERT(capacity() == other->capacity());
+    memcpy(PTR(this, kOccupancyOffset), PTR(other, kOccupancyOffset), MapSize(capacity()) - kOccupancyOffset);
+  }
 
-      // If the entry at position q has its initial position outside the range
-      // between p and q it can be moved forward to position p and will still be
-      // found. There is now a new candidate entry for clearing.
-      if ((q > p && (r <= p || r > q)) ||
-          (q < p && (r <= p && r > q))) {
-        *p = *q;
-        p = q;
-      }
+ private:
+  static constexpr uint8_t kEmpty = 0;
+  static constexpr uint8_t kDeleted = 1;
+  static constexpr uint32_t kNotFound = static_cast<uint32_t>(-1);
+  // The control byte of a full entry has the highest bit set.
+  static uint8_t H2(uint32_t hash) { return 0x80 | (hash & 0x7F); }
+  static uint32_t H1(uint32_t hash) { return hash >> 7; }
+
+  // The control array is at least one group, the bytes after capacity are
+  // never valid.
+  static uint32_t ControlSize(uint32_t capacity) {
+    return capacity < ControlGroup::kWidth ? ControlGroup::kWidth : capacity;
+  }
+  // Keep the load under 7/8 so that every probe ends at an empty slot.
+  static uint32_t MaxEntries(uint32_t capacity) { return capacity * 7 / 8; }
+  static size_t IndexOffset(uint32_t capacity) {
+    return kControlOffset + ControlSize(capacity);
+  }
+  static size_t EntryOffset(uint32_t capacity) {
+    return IndexOffset(capacity) + capacity * kUint32Size;
+  }
+  static size_t MapSize(uint32_t capacity) {
+    return EntryOffset(capacity) + MaxEntries(capacity) * sizeof(Entry);
+  }
+  uint32_t NumGroups() { return ControlSize(capacity()) / ControlGroup::kWidth; }
+  uint32_t ValidMask() {
+    uint32_t cap = capacity();
+    return cap < ControlGroup::kWidth ? (1u << cap) - 1 : 0xFFFF;
+  }
+
+  template<flag_t flag = 0>
+  static Handle<HashMapV2> NewWithCapacity(uint32_t capacity) {
+#ifdef GC_DEBUG
+    if (unlikely(log::Debugger::On()))
+      std::cout << "HashMapV2::New" << "\n";
+#endif
+    assert(IsPowerOf2(capacity));
+
+    if (!(flag & GCFlag::CONST) && ExtracGC::resize_released_maps[capacity].size()) {
+      // no memory allocation
+      Handle<HashMapV2> jsval(ExtracGC::resize_released_maps[capacity].top());
+      ExtracGC::resize_released_maps[capacity].pop();
+      jsval.val()->Clear();
+      return jsval;
     }
 
-    // Clear the entry which is allowed to en emptied.
-    p->key = NULL;
-    set_occupancy(occupancy() - 1);
+    Handle<HashMapV2> jsval = HeapObject::New<flag>(MapSize(capacity) - HeapObject::kHeapObjectOffset);
+
+    SET_VALUE(jsval.val(), kCapacityOffset, capacity, uint32_t);
+
+    jsval.val()->SetType(HASHMAP_V2);
+    // do not need to set to 0 as the heap is already 0ed, and 0 is the
+    // control byte of empty entries.
+    //jsval.val()->Clear();
+    return jsval;
   }
 
-  template<typename Filter>
-  std::vector<Handle<String>> SortedKeys(Filter filter) {
-    std::priority_queue<Entry*, std::vector<Entry*>, CompareListNode> pq;
-    uint32_t n = occupancy();
-    for (Entry* p = map_start(); n > 0; ++p) {
-      if (!p->is_empty()) {
-        pq.push(p);
-        n--;
+  // Make sure there is room for one more entry. The deleted entries still
+  // take their place in the dense array until the resize.
+  static Handle<HashMapV2> ReserveOne(Handle<HashMapV2> map) {
+    if (map.val()->num_used() + 1 > MaxEntries(map.val()->capacity()))
+      return Resize(map);
+    return map;
+  }
+
+  uint32_t FindSlot(String* key, uint32_t hash) {
+    ASSERT(key != NULL);
+    uint8_t* ctrl = control();
+    uint32_t* idx = index();
+    Entry* map = map_start();
+    uint32_t valid = ValidMask();
+    uint32_t group_mask = NumGroups() - 1;
+    uint8_t h2 = H2(hash);
+    uint32_t g = H1(hash) & group_mask;
+    for (uint32_t step = 1; ; ++step) {
+      ControlGroup group(ctrl + g * ControlGroup::kWidth);
+      uint32_t match = group.Match(h2) & valid;
+      while (match) {
+        uint32_t slot = g * ControlGroup::kWidth + __builtin_ctz(match);
+        Entry* p = map + idx[slot];
+        if (hash == p->hash && StringEqual(key, p->key))
+          return slot;
+        match &= match - 1;
       }
+      if (group.Match(kEmpty) & valid)
+        return kNotFound;
+      // Triangular probing visits every group as the number of groups is
+      // a power of 2.
+      g = (g + step) & group_mask;
     }
-    std::vector<Handle<String>> result;
-    while (!pq.empty()) {
-      Entry* p = pq.top();
-      pq.pop();
-      if (filter(p)) {
-        result.emplace_back(p->key);
-      }
+  }
+
+  // Return the first empty or deleted slot on the probe sequence.
+  uint32_t FindInsertSlot(uint32_t hash) {
+    uint8_t* ctrl = control();
+    uint32_t valid = ValidMask();
+    uint32_t group_mask = NumGroups() - 1;
+    uint32_t g = H1(hash) & group_mask;
+    for (uint32_t step = 1; ; ++step) {
+      ControlGroup group(ctrl + g * ControlGroup::kWidth);
+      uint32_t available = (group.Match(kEmpty) | group.Match(kDeleted)) & valid;
+      if (available)
+        return g * ControlGroup::kWidth + __builtin_ctz(available);
+      g = (g + step) & group_mask;
     }
-    return result;
   }
 
-  void Clear() {
-    memset(PTR(this, kOccupancyOffset), 0, capacity() * sizeof(Entry) + kUint32Size);
+  // Append a new entry to the dense array, there must be room for it.
+  Entry* Insert(String* key, uint32_t hash) {
+    uint32_t slot = FindInsertSlot(hash);
+    uint32_t n = num_used();
+    ASSERT(n < MaxEntries(capacity()));
+    control()[slot] = H2(hash);
+    index()[slot] = n;
+    set_num_used(n + 1);
+    set_occupancy(occupancy() + 1);
+    Entry* p = map_start() + n;
+    p->key = key;
+    p->hash = hash;
+    return p;
+  }
+
+  Entry* FindOrInsert(String* key, uint32_t hash, bool& created) {
+    uint32_t slot = FindSlot(key, hash);
+    created = slot == kNotFound;
+    if (!created)
+      return map_start() + index()[slot];
+    return Insert(key, hash);
   }
 
- private:
   static Handle<HashMapV2> Resize(Handle<HashMapV2> map) {
-    Handle<HashMapV2> new_map = HashMapV2::New(map.val()->capacity());
+    uint32_t cap = map.val()->capacity();
+    // Only compact in place when most of the dense array are holes.
+    uint32_t new_cap = map.val()->occupancy() * 2 < cap ? cap : cap * 2;
+    Handle<HashMapV2> new_map = NewWithCapacity(new_cap);
 
-    uint32_t n = map.val()->occupancy();
-    new_map.val()->set_occupancy(n);
-    // Rehash all current entries.
-    for (Entry* p = map.val()->map_start(); n > 0; p++) {
+    // Rehash all current entries, keeping their order.
+    for (Entry* p = map.val()->map_start(); p < map.val()->map_end(); p++) {
       if (!p->is_empty()) {
-        Entry* new_p = new_map.val()->Probe(p->key, p->hash);
-        new_p->hash = p->hash;
-        new_p->key = p->key;
+        Entry* new_p = new_map.val()->Insert(p->key, p->hash);
         new_p->val = p->val;
         new_p->meta_ = p->meta_;
-        n--;
       }
     }
+    ExtracGC::resize_released_maps[cap].push(map.val());
     return new_map;
   }
 
-
-  // TODO(zhuzilin) The order of the properties are determined by ES5 spec.
-  // However, array need to have a ordered property.
-  // Try to follow the traverse order in ES6
-  static bool LessThan(String* a, String* b) {
-    bool num_a = a->IsArrayIndex();
-    bool num_b = b->IsArrayIndex();
-    return num_a == num_b ? StringLessThan(a, b) : num_a > num_b;
-  }
-
-  struct CompareListNode {
-    bool operator()(Entry* x, Entry* y) {
-      return !LessThan(x->key, y->key);
-    }
-  };
-
  public:
   static constexpr size_t kCapacityOffset = HeapObject::kHeapObjectOffset;
   static constexpr size_t kOccupancyOffset = kCapacityOffset + kUint32Size;
-  static constexpr size_t kElementOffset = kOccupancyOffset + kUint32Size;
+  static constexpr size_t kNumUsedOffset = kOccupancyOffset + kUint32Size;
+  static constexpr size_t kEnumCacheOffset = kNumUsedOffset + kUint32Size + kUint32Size;
+  static constexpr size_t kControlOffset = kEnumCacheOffset + kPtrSize;
 };
 
 }  // namespace es
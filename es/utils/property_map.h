@@ -1,7 +1,7 @@
 #ifndef ES_UTILS_PROPERTY_MAP_H
 #define ES_UTILS_PROPERTY_MAP_H
 
-#include <queue>
+#include <algorithm>
 #include <unordered_map>
 
 #include <es/types/base.h>
@@ -12,173 +12,332 @@
 
 namespace es {
 
-// These 2 conversions only happens here.
-Handle<JSValue> ToHeap(StackPropertyDescriptor desc) {
-  if (desc.IsUndefined())
-    return Undefined::Instance();
-  auto new_desc = PropertyDescriptor::New();
-  if (desc.HasValue()) {
-    new_desc.val()->SetValue(desc.Value());
-    if (desc.HasWritable())
-      new_desc.val()->SetWritable(desc.Writable());
-  } else {
-    if (desc.HasGet())
-      new_desc.val()->SetGet(desc.Get());
-    if (desc.HasSet())
-      new_desc.val()->SetSet(desc.Set());
-  }
-  if (desc.HasConfigurable())
-    new_desc.val()->SetConfigurable(desc.Configurable());
-  if (desc.HasEnumerable())
-    new_desc.val()->SetEnumerable(desc.Enumerable());
-  return new_desc;
+// The attributes of a property are saved in the bit fields next to its
+// value, where `p` is either a HashMapV2::Entry or a PropertyMap::Slot.
+// Only accessor properties need an extra heap object for the getter and
+// setter. These 2 conversions only happens here.
+template<typename Attributes>
+void SetAttributes(Attributes* p, StackPropertyDescriptor desc) {
+  p->has_writable = desc.HasWritable();
+  p->writable = desc.Writable();
+  p->has_configurable = desc.HasConfigurable();
+  p->configurable = desc.Configurable();
+  p->has_enumerable = desc.HasEnumerable();
+  p->enumerable = desc.Enumerable();
 }
 
-StackPropertyDescriptor ToStack(JSValue* val) {
-  if (val == nullptr || val->IsUndefined())
-    return StackPropertyDescriptor::Undefined();
-  ASSERT(val->IsPropertyDescriptor());
-  PropertyDescriptor* desc = static_cast<PropertyDescriptor*>(val);
-  StackPropertyDescriptor new_desc;
-  if (desc->HasValue()) {
-    new_desc.SetValue(desc->Value());
-    if (desc->HasWritable())
-      new_desc.SetWritable(desc->Writable());
-  } else {
-    if (desc->HasGet())
-      new_desc.SetGet(desc->Get());
-    if (desc->HasSet())
-      new_desc.SetSet(desc->Set());
-  }
-  if (desc->HasConfigurable())
-    new_desc.SetConfigurable(desc->Configurable());
-  if (desc->HasEnumerable())
-    new_desc.SetEnumerable(desc->Enumerable());
-  return new_desc;
+template<typename Attributes>
+bool IsEnumerable(Attributes* p) {
+  return p->has_enumerable && p->enumerable;
 }
 
-class PropertyMap : public JSValue {
- public:
-  static Handle<PropertyMap> New(size_t num_fixed_slots = 0, size_t guessed_occupancy = 0) {
-#ifdef GC_DEBUG
-    if (unlikely(log::Debugger::On()))
-      std::cout << "PropertyMap::New" << "\n";
-#endif
-    Handle<JSValue> jsval = HeapObject::New(kElementOffset + num_fixed_slots * kPtrSize - HeapObject::kHeapObjectOffset);
+template<typename Attributes>
+StackPropertyDescriptor ToStack(Attributes* p) {
+  StackPropertyDescriptor desc;
+  if (p->val->IsAccessorPair()) {
+    AccessorPair* pair = static_cast<AccessorPair*>(p->val);
+    if (pair->HasGet())
+      desc.SetGet(pair->Get());
+    if (pair->HasSet())
+      desc.SetSet(pair->Set());
+  } else {
+    desc.SetValue(Handle<JSValue>(p->val));
+    if (p->has_writable)
+      desc.SetWritable(p->writable);
+  }
+  if (p->has_configurable)
+    desc.SetConfigurable(p->configurable);
+  if (p->has_enumerable)
+    desc.SetEnumerable(p->enumerable);
+  return desc;
+}
 
-    Handle<HashMapV2> hashmap = HashMapV2::New(guessed_occupancy);
-    SET_VALUE(jsval.val(), kNumFixedSlotsOffset, num_fixed_slots, size_t);
-    SET_HANDLE_VALUE(jsval.val(), kHashMapOffset, hashmap, HashMapV2);
+// Lookups that miss on the receiver and go up the prototype chain, keyed
+// by the prototype of the receiver and the name. The entry points to the
+// property found, or is nullptr when no object on the chain has it. All
+// entries are guarded by `epoch`, which is bumped whenever an object used
+// as a prototype is changed, so a hit skips both the walk and the lookup in
+// the holder. Cleared before each collection, as the objects may move.
+struct PrototypeLookupCache {
+  struct Entry {
+    JSValue* proto;
+    String* name;
+    HashMapV2::Entry* holder_entry;
+    uint64_t epoch;
+  };
 
-    for (size_t i = 0; i < num_fixed_slots; ++i) {
-      SET_VALUE(jsval.val(), kElementOffset + i * kPtrSize, nullptr, JSValue*);
-    }
+  static Entry* Slot(JSValue* proto, String* name) {
+    size_t hash = (reinterpret_cast<uintptr_t>(proto) >> 4) ^ name->Hash();
+    return entries + hash % kSize;
+  }
 
-    jsval.val()->SetType(PROPERTY_MAP);
-    return Handle<PropertyMap>(jsval);
+  static bool IsHit(Entry* entry, JSValue* proto, String* name) {
+    return entry->epoch == epoch && entry->proto == proto &&
+           (entry->name == name || StringEqual(entry->name, name));
   }
 
-  uint32_t num_fixed_slots() { return READ_VALUE(this, kNumFixedSlotsOffset, uint32_t); }
-  Handle<HashMapV2> hashmap() { return READ_HANDLE_VALUE(this, kHashMapOffset, HashMapV2); }
-  void SetHashMap(Handle<HashMapV2> hashmap) { SET_HANDLE_VALUE(this, kHashMapOffset, hashmap, HashMapV2); }
-  JSValue* GetRawArray(size_t index) {
-    ASSERT(index < num_fixed_slots());
-    return READ_VALUE(this, kElementOffset + index * kPtrSize, JSValue*);
+  static void Invalidate() { ++epoch; }
+
+  static void Clear() { memset(entries, 0, sizeof(entries)); }
+
+  static constexpr size_t kSize = 1024;
+  static Entry entries[kSize];
+  // Starts from 1, so that the empty entries are never hit.
+  static uint64_t epoch;
+};
+
+PrototypeLookupCache::Entry PrototypeLookupCache::entries[kSize];
+uint64_t PrototypeLookupCache::epoch = 1;
+
+// The identifiers cache where the values of the global bindings are, see
+// Identifier. The cached pointers go into the hashmap of the global object,
+// so they are invalidated when a global binding is added, deleted or
+// reconfigured, and before each collection.
+struct GlobalCells {
+  static void Invalidate() { ++epoch; }
+
+  // Starts from 1, so that an identifier that has never cached is invalid.
+  static uint64_t epoch;
+};
+
+uint64_t GlobalCells::epoch = 1;
+
+// The named properties of an object. It is not a heap object but lives
+// inline in the JSObject, and the fixed slots are placed at the end of the
+// object, so a new object takes only one allocation. The hashmap is
+// created when the first key that does not fit the fixed slots is set.
+class PropertyMap {
+ public:
+  // Same attribute bits as HashMapV2::Entry.
+  struct Slot {
+    JSValue* val;
+    union {
+      struct {
+        bool has_writable;
+        bool has_configurable;
+        bool has_enumerable;
+        bool writable : 1;
+        bool configurable : 1;
+        bool enumerable : 1;
+      };
+      uint32_t meta_;
+    };
+    bool is_empty() { return val == nullptr; }
+  };
+
+  static_assert(sizeof(Slot) == 16);
+
+  // The memory is already 0ed, so the hashmap and the slots are empty.
+  void Init(uint32_t num_fixed_slots, uint32_t slots_offset, uint32_t guessed_occupancy) {
+    num_fixed_slots_ = num_fixed_slots;
+    slots_offset_ = slots_offset;
+    guessed_occupancy_ = guessed_occupancy;
   }
-  void SetRawArray(size_t index, JSValue* val) {
+
+  uint32_t num_fixed_slots() { return num_fixed_slots_; }
+  // Whether the owner is the prototype of some object, the changes of
+  // which invalidate the PrototypeLookupCache.
+  bool is_prototype() { return is_prototype_; }
+  void set_is_prototype() { is_prototype_ = true; }
+  bool is_global() { return is_global_; }
+  void set_is_global() { is_global_ = true; }
+  // Whether the owner has properties that are not created yet, the "length"
+  // and "prototype" of a function object or the "message" of an error
+  // object, see FunctionObject::MaterializeProperties and
+  // ErrorObject::MaterializeProperties.
+  bool has_pending_properties() { return has_pending_properties_; }
+  void set_has_pending_properties(bool b) { has_pending_properties_ = b; }
+  // nullptr when no key has been hashed.
+  HashMapV2* hashmap() { return hashmap_; }
+  uint32_t occupancy() { return hashmap_ == nullptr ? 0 : hashmap_->occupancy(); }
+  Slot* GetSlot(size_t index) {
     ASSERT(index < num_fixed_slots());
-    SET_VALUE(this, kElementOffset + index * kPtrSize, val, JSValue*);
+    return reinterpret_cast<Slot*>(reinterpret_cast<char*>(this) + slots_offset_) + index;
   }
 
-  // Set can not be method as there can be gc happening inside.
-  static void Set(Handle<PropertyMap> map, Handle<String> key, StackPropertyDescriptor desc) {
-    if (map.val()->IsSmallArrayIndex(key)) {
-      Handle<PropertyDescriptor> val = ToHeap(desc);
-      uint32_t index = key.val()->Index();
-      map.val()->SetRawArray(index, val.val());
+  // Set can not be method as there can be gc happening inside, so it takes
+  // the object that owns the map.
+  template<typename Object>
+  static void Set(Handle<Object> obj, Handle<String> key, StackPropertyDescriptor desc) {
+    // 8.12.9 step 4.a, a generic descriptor creates a data property.
+    Handle<JSValue> val = desc.IsAccessorDescriptor() ?
+        static_cast<Handle<JSValue>>(AccessorPair::New(desc)) : desc.Value();
+    PropertyMap* map = obj.val()->named_properties();
+    if (map->is_prototype())
+      PrototypeLookupCache::Invalidate();
+    if (map->is_global())
+      GlobalCells::Invalidate();
+    if (map->IsSmallArrayIndex(key)) {
+      Slot* p = map->GetSlot(key.val()->Index());
+      p->val = val.val();
+      SetAttributes(p, desc);
       return;
     }
-    auto hashmap = map.val()->hashmap();
-    if (desc.IsDataDescriptor()) {
-      auto entry_fn = [&desc] (HashMapV2::Entry* p) {
-        p->has_writable = desc.HasWritable();
-        p->writable = desc.Writable();
-        p->has_configurable = desc.HasConfigurable();
-        p->configurable = desc.Configurable();
-        p->has_enumerable = desc.HasEnumerable();
-        p->enumerable = desc.Enumerable();
-      };
-      ASSERT(desc.HasValue());
-      hashmap = HashMapV2::Set(hashmap, key, desc.Value(), entry_fn);
-    } else {
-      Handle<PropertyDescriptor> val = ToHeap(desc);
-      hashmap = HashMapV2::Set(hashmap, key, val);
-    }
-    map.val()->SetHashMap(hashmap);
+    Handle<HashMapV2> hashmap = map->hashmap_ == nullptr ?
+        HashMapV2::New(map->guessed_occupancy_) : Handle<HashMapV2>(map->hashmap_);
+    auto entry_fn = [&desc] (HashMapV2::Entry* p) {
+      SetAttributes(p, desc);
+    };
+    hashmap = HashMapV2::Set(hashmap, key, val, entry_fn);
+    obj.val()->named_properties()->hashmap_ = hashmap.val();
+  }
+
+  // Give the map of `obj`, which has no key yet, a copy of the constant
+  // hashmap `boilerplate` that has the capacity of guessed occupancy.
+  template<typename Object>
+  static void CopyFrom(Handle<Object> obj, HashMapV2* boilerplate) {
+    Handle<HashMapV2> hashmap = HashMapV2::New(obj.val()->named_properties()->guessed_occupancy_);
+    hashmap.val()->CopyFrom(boilerplate);
+    obj.val()->named_properties()->hashmap_ = hashmap.val();
   }
 
   StackPropertyDescriptor Get(Handle<String> key) {
-    JSValue* val;
     if (IsSmallArrayIndex(key)) {
-      uint32_t index = key.val()->Index();
-      val = GetRawArray(index);
-      return ToStack(val);
-    } else {
-      StackPropertyDescriptor desc;
-      auto entry_fn = [&desc](HashMapV2::Entry* p) mutable {
-        ASSERT(p != nullptr && p->val != nullptr);
-        if (p->val->IsPropertyDescriptor()) {
-          desc = ToStack(p->val);
-        } else {
-          desc.SetValue(Handle<JSValue>(p->val));
-          if (p->has_writable)
-            desc.SetWritable(p->writable);
-          if (p->has_configurable)
-            desc.SetConfigurable(p->configurable);
-          if (p->has_enumerable)
-            desc.SetEnumerable(p->enumerable);
-        }
-      };
-      JSValue* val = hashmap().val()->GetRaw(key, entry_fn);
-      if (val == nullptr)
+      Slot* p = GetSlot(key.val()->Index());
+      if (p->is_empty())
         return StackPropertyDescriptor::Undefined();
-      return desc;
+      return ToStack(p);
     }
+    HashMapV2::Entry* p = GetEntry(key);
+    if (p == nullptr)
+      return StackPropertyDescriptor::Undefined();
+    return ToStack(p);
+  }
+
+  // The value of the data property `key`, nullptr if there is no such
+  // property or it is an accessor.
+  JSValue* GetDataValue(Handle<String> key) {
+    JSValue* val = nullptr;
+    if (IsSmallArrayIndex(key)) {
+      val = GetSlot(key.val()->Index())->val;
+    } else {
+      HashMapV2::Entry* p = GetEntry(key);
+      if (p != nullptr)
+        val = p->val;
+    }
+    if (val == nullptr || val->IsAccessorPair())
+      return nullptr;
+    return val;
+  }
+
+  HashMapV2::Entry* GetEntry(Handle<String> key) {
+    if (hashmap_ == nullptr)
+      return nullptr;
+    return hashmap_->GetEntry(key);
   }
 
   void Delete(Handle<String> key) {
+    if (is_prototype())
+      PrototypeLookupCache::Invalidate();
+    if (is_global())
+      GlobalCells::Invalidate();
     if (IsSmallArrayIndex(key)) {
-      uint32_t index = key.val()->Index();
-      SetRawArray(index, nullptr);
+      GetSlot(key.val()->Index())->val = nullptr;
       return;
     }
-    hashmap().val()->Delete(key);
+    if (hashmap_ != nullptr)
+      hashmap_->Delete(key);
   }
 
-  template<typename DescFilter, typename EntryFilter>
-  std::vector<Handle<String>> SortedKeys(DescFilter desc_filter, EntryFilter entry_filter) {
-    std::vector<Handle<String>> result;
+  // Call fn(key, p) for each property, where p is either a Slot* or a
+  // HashMapV2::Entry*. The order follows [[OwnPropertyKeys]] of ES6: the
+  // array indices in ascending order and then the other keys in the order
+  // of insertion. fn must not allocate on the heap.
+  template<typename Fn>
+  void ForEach(Fn fn) {
     for (uint32_t i = 0; i < num_fixed_slots(); ++i) {
-      PropertyDescriptor* desc = static_cast<PropertyDescriptor*>(GetRawArray(i));
-      if (desc && desc_filter(desc)) {
-        result.emplace_back(String::New(i));
-      }
+      Slot* p = GetSlot(i);
+      if (!p->is_empty())
+        fn(String::New(i), p);
+    }
+    if (hashmap_ == nullptr)
+      return;
+    // Indices that do not fit in the fixed slots are rare, only sort them
+    // when they are not inserted in order.
+    std::vector<HashMapV2::Entry*> indices;
+    for (HashMapV2::Entry* p = hashmap_->map_start(); p < hashmap_->map_end(); ++p) {
+      if (!p->is_empty() && IsIndexKey(p->key))
+        indices.emplace_back(p);
+    }
+    auto index_less = [](HashMapV2::Entry* a, HashMapV2::Entry* b) {
+      return a->key->Index() < b->key->Index();
+    };
+    if (!std::is_sorted(indices.begin(), indices.end(), index_less))
+      std::sort(indices.begin(), indices.end(), index_less);
+    for (HashMapV2::Entry* p : indices)
+      fn(Handle<String>(p->key), p);
+    for (HashMapV2::Entry* p = hashmap_->map_start(); p < hashmap_->map_end(); ++p) {
+      if (!p->is_empty() && !IsIndexKey(p->key))
+        fn(Handle<String>(p->key), p);
     }
-    std::vector<Handle<String>> hashmap_result = hashmap().val()->SortedKeys(entry_filter);
-    result.insert(result.end(), hashmap_result.begin(), hashmap_result.end());
+  }
+
+  // `filter` is called with both Slot* and HashMapV2::Entry*.
+  template<typename Filter>
+  std::vector<Handle<String>> Keys(Filter filter) {
+    std::vector<Handle<String>> result;
+    ForEach([&](Handle<String> key, auto* p) {
+      if (filter(p))
+        result.emplace_back(key);
+    });
     return result;
   }
 
+  // The enumerable keys in the order of ForEach. The list is cached in the
+  // hashmap until the next insertion, redefinition or deletion, so an object
+  // that is enumerated again reuses it. Only for maps without fixed slots.
+  template<typename Object>
+  static Handle<FixedArray> EnumerableKeys(Handle<Object> obj) {
+    PropertyMap* map = obj.val()->named_properties();
+    ASSERT(map->num_fixed_slots() == 0);
+    if (map->hashmap_ != nullptr && map->hashmap_->enum_cache() != nullptr)
+      return Handle<FixedArray>(map->hashmap_->enum_cache());
+    Handle<FixedArray> keys = FixedArray::New(map->Keys([](auto* p) { return IsEnumerable(p); }));
+    map = obj.val()->named_properties();
+    if (map->hashmap_ != nullptr)
+      map->hashmap_->set_enum_cache(keys.val());
+    return keys;
+  }
+
+  bool HasEnumerableKeys() {
+    if (hashmap_ != nullptr && hashmap_->enum_cache() != nullptr)
+      return hashmap_->enum_cache()->size() > 0;
+    bool found = false;
+    ForEach([&](Handle<String> key, auto* p) {
+      found = found || IsEnumerable(p);
+    });
+    return found;
+  }
+
+  // Whether `key` is ordered as an array index by ForEach. 2^32-1 is saved
+  // as an index string but is not an array index (15.4).
+  static bool IsIndexKey(String* key) {
+    return key->IsArrayIndex() && key->Index() != 0xFFFFFFFF;
+  }
+
   bool IsSmallArrayIndex(Handle<String> key) {
     return key.val()->IsArrayIndex() && key.val()->Index() < num_fixed_slots();
   }
 
- public:
-  static constexpr size_t kNumFixedSlotsOffset = HeapObject::kHeapObjectOffset;
-  static constexpr size_t kHashMapOffset = kNumFixedSlotsOffset + kSizeTSize;
-  static constexpr size_t kElementOffset = kHashMapOffset + kPtrSize;
+  std::string ToString() {
+    return "PropertyMap(" + std::to_string(num_fixed_slots()) + "," + std::to_string(occupancy()) + ")";
+  }
+
+ private:
+  // Need to be the first member, so that gc could trace it at the offset
+  // of the map.
+  HashMapV2* hashmap_;
+  uint32_t num_fixed_slots_;
+  // The offset from the map to the first fixed slot.
+  uint32_t slots_offset_;
+  uint32_t guessed_occupancy_;
+  bool is_prototype_;
+  bool is_global_;
+  bool has_pending_properties_;
 };
 
+static_assert(sizeof(PropertyMap) == 24);
+
 }  // namespace es
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,164 @@
+#ifndef ES_UTILS_SIMD_H
+#define ES_UTILS_SIMD_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <es/utils/macros.h>
+
+namespace es {
+namespace simd {
+
+constexpr size_t npos = static_cast<size_t>(-1);
+
+// Kernels over utf-16 buffers. Each vector compare gives a byte mask,
+// so every char16_t takes 2 bits of the mask.
+#if defined(__AVX2__)
+
+struct Block {
+  static constexpr size_t kWidth = 16;
+  static constexpr uint32_t kFullMask = 0xFFFFFFFF;
+
+  static Block Load(const char16_t* p) {
+    return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+  }
+  static Block Splat(char16_t c) { return {_mm256_set1_epi16(c)}; }
+
+  uint32_t Equal(Block b) const {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi16(v, b.v));
+  }
+
+  __m256i v;
+};
+
+#elif defined(__SSE2__)
+
+struct Block {
+  static constexpr size_t kWidth = 8;
+  static constexpr uint32_t kFullMask = 0xFFFF;
+
+  static Block Load(const char16_t* p) {
+    return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+  }
+  static Block Splat(char16_t c) { return {_mm_set1_epi16(c)}; }
+
+  uint32_t Equal(Block b) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(v, b.v));
+  }
+
+  __m128i v;
+};
+
+#else
+
+// Scalar fallback, a block of one char.
+struct Block {
+  static constexpr size_t kWidth = 1;
+  static constexpr uint32_t kFullMask = 3;
+
+  static Block Load(const char16_t* p) { return {*p}; }
+  static Block Splat(char16_t c) { return {c}; }
+
+  uint32_t Equal(Block b) const { return v == b.v ? kFullMask : 0; }
+
+  char16_t v;
+};
+
+#endif
+
+// Return the first index i that a[i] != b[i], or n if there is none.
+inline size_t Mismatch(const char16_t* a, const char16_t* b, size_t n) {
+  size_t i = 0;
+  for (; i + Block::kWidth <= n; i += Block::kWidth) {
+    uint32_t mask = Block::Load(a + i).Equal(Block::Load(b + i));
+    if (mask != Block::kFullMask)
+      return i + __builtin_ctz(~mask) / 2;
+  }
+  for (; i < n; ++i) {
+    if (a[i] != b[i])
+      return i;
+  }
+  return n;
+}
+
+inline bool Equal(const char16_t* a, const char16_t* b, size_t n) {
+  return Mismatch(a, b, n) == n;
+}
+
+// Three way comparison of the code units, like std::u16string::compare.
+inline int Compare(const char16_t* a, size_t n, const char16_t* b, size_t m) {
+  size_t size = n < m ? n : m;
+  size_t i = Mismatch(a, b, size);
+  if (i != size)
+    return a[i] < b[i] ? -1 : 1;
+  return n == m ? 0 : (n < m ? -1 : 1);
+}
+
+// The first occurrence of pattern p in s starting at or after pos.
+// Candidates are filtered by comparing both the first and the last char of
+// p with a whole block of s at once, then verified.
+inline size_t Find(const char16_t* s, size_t n, const char16_t* p, size_t m, size_t pos = 0) {
+  if (m == 0)
+    return pos <= n ? pos : npos;
+  if (m > n || pos > n - m)
+    return npos;
+  size_t last = n - m;
+  Block first = Block::Splat(p[0]);
+  Block tail = Block::Splat(p[m - 1]);
+  size_t i = pos;
+  for (; i + Block::kWidth <= last + 1; i += Block::kWidth) {
+    uint32_t mask = Block::Load(s + i).Equal(first) &
+                    Block::Load(s + i + m - 1).Equal(tail);
+    while (mask) {
+      size_t bit = __builtin_ctz(mask);
+      if (Equal(s + i + bit / 2, p, m))
+        return i + bit / 2;
+      mask &= ~(3u << bit);
+    }
+  }
+  for (; i <= last; ++i) {
+    if (s[i] == p[0] && Equal(s + i, p, m))
+      return i;
+  }
+  return npos;
+}
+
+// The last occurrence of pattern p in s starting at or before pos.
+inline size_t RFind(const char16_t* s, size_t n, const char16_t* p, size_t m, size_t pos = npos) {
+  if (m > n)
+    return npos;
+  size_t start = n - m < pos ? n - m : pos;
+  if (m == 0)
+    return start;
+  Block first = Block::Splat(p[0]);
+  Block tail = Block::Splat(p[m - 1]);
+  // Number of candidate positions in [0, start].
+  size_t remain = start + 1;
+  for (; remain >= Block::kWidth; remain -= Block::kWidth) {
+    size_t i = remain - Block::kWidth;
+    uint32_t mask = Block::Load(s + i).Equal(first) &
+                    Block::Load(s + i + m - 1).Equal(tail);
+    while (mask) {
+      size_t bit = 31 - __builtin_clz(mask);
+      if (Equal(s + i + bit / 2, p, m))
+        return i + bit / 2;
+      mask &= ~(3u << (bit - 1));
+    }
+  }
+  while (remain--) {
+    if (s[remain] == p[0] && Equal(s + remain, p, m))
+      return remain;
+  }
+  return npos;
+}
+
+}  // namespace simd
+}  // namespace es
+
+#endif  // ES_UTILS_SIMD_H
@@ -0,0 +1,51 @@
+#ifndef ES_UTILS_SPAN_H
+#define ES_UTILS_SPAN_H
+
+#include <stddef.h>
+
+#include <initializer_list>
+#include <vector>
+
+namespace es {
+
+// A read only view of contiguous elements, which does not own them.
+// The elements must outlive the span, so a span made from a temporary
+// vector or initializer list is only valid in the same full expression.
+template<typename T>
+class Span {
+ public:
+  Span() : data_(nullptr), size_(0) {}
+  Span(const T* data, size_t size) : data_(data), size_(size) {}
+  // The backing array of the list lives until the end of the full
+  // expression, which is long enough for `Call(e, f, this_arg, {x, y})`.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winit-list-lifetime"
+#endif
+  Span(std::initializer_list<T> list) : data_(list.begin()), size_(list.size()) {}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+  Span(const std::vector<T>& vec) : data_(vec.data()), size_(vec.size()) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const T& operator[](size_t i) const { return data_[i]; }
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+
+  // The elements from `offset` to the end.
+  Span subspan(size_t offset) const {
+    if (offset >= size_)
+      return Span();
+    return Span(data_ + offset, size_ - offset);
+  }
+
+ private:
+  const T* data_;
+  size_t size_;
+};
+
+}  // namespace es
+
+#endif  // ES_UTILS_SPAN_H
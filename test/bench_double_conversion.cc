@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <es/utils/double_conversion.h>
+
+using namespace es;
+
+// Compare DoubleToChars and CharsToDouble with snprintf and strtod.
+// Run with an optional number of rounds, e.g. ./bench_double_conversion 100
+
+template<typename F>
+void Run(const char* name, size_t rounds, size_t count, F f) {
+  size_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < count; ++i)
+      sink += f(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / (rounds * count);
+  printf("%-28s %8.1f ns/op  (%zu)\n", name, ns, sink);
+}
+
+int main(int argc, char* argv[]) {
+  size_t rounds = argc > 1 ? atol(argv[1]) : 100;
+  std::vector<std::pair<const char*, std::vector<double>>> inputs(3);
+  inputs[0].first = "integers";
+  inputs[1].first = "short decimals";
+  inputs[2].first = "random doubles";
+  uint64_t seed = 1;
+  for (size_t i = 0; i < 10000; ++i) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    inputs[0].second.push_back(static_cast<double>(seed >> 40));
+    inputs[1].second.push_back(static_cast<double>(seed >> 50) / 100);
+    double d;
+    uint64_t bits = seed >> 2;  // positive, finite
+    memcpy(&d, &bits, sizeof(d));
+    inputs[2].second.push_back(d);
+  }
+
+  for (auto& input : inputs) {
+    std::vector<double>& values = input.second;
+    std::vector<std::u16string> strs;
+    std::vector<std::string> cstrs;
+    for (double d : values) {
+      char16_t buf[kMaxDoubleCharsSize];
+      strs.emplace_back(buf, DoubleToChars(d, buf));
+      char cbuf[kMaxDoubleCharsSize];
+      cstrs.emplace_back(cbuf, DoubleToChars(d, cbuf));
+    }
+    printf("%s\n", input.first);
+    Run("DoubleToChars", rounds, values.size(), [&](size_t i) {
+      char16_t buf[kMaxDoubleCharsSize];
+      return DoubleToChars(values[i], buf);
+    });
+    Run("snprintf %.17g", rounds, values.size(), [&](size_t i) {
+      char buf[kMaxDoubleCharsSize];
+      return size_t(snprintf(buf, sizeof(buf), "%.17g", values[i]));
+    });
+    Run("CharsToDouble", rounds, values.size(), [&](size_t i) {
+      return size_t(CharsToDouble(strs[i].data(), strs[i].size()) == values[i]);
+    });
+    Run("strtod", rounds, values.size(), [&](size_t i) {
+      return size_t(strtod(cstrs[i].c_str(), nullptr) == values[i]);
+    });
+  }
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <stdio.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <es/utils/simd.h>
+
+using namespace es;
+
+typedef std::u16string string;
+
+// Compare the simd kernels with the char by char loops they replaced.
+// Run with an optional iteration count, e.g. ./bench_simd 100000
+
+namespace scalar {
+
+bool Equal(const char16_t* a, const char16_t* b, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (a[i] != b[i])
+      return false;
+  }
+  return true;
+}
+
+int Compare(const char16_t* a, size_t n, const char16_t* b, size_t m) {
+  size_t len = n < m ? n : m;
+  for (size_t i = 0; i < len; ++i) {
+    if (a[i] != b[i])
+      return a[i] < b[i] ? -1 : 1;
+  }
+  return n == m ? 0 : (n < m ? -1 : 1);
+}
+
+size_t Find(const char16_t* s, size_t n, const char16_t* p, size_t m) {
+  for (size_t i = 0; i + m <= n; ++i) {
+    if (Equal(s + i, p, m))
+      return i;
+  }
+  return simd::npos;
+}
+
+}  // namespace scalar
+
+template<typename F>
+void Run(const char* name, size_t iters, F f) {
+  size_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iters; ++i)
+    sink += f();
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / iters;
+  printf("%-24s %10.1f ns/op  (%zu)\n", name, ns, sink);
+}
+
+int main(int argc, char* argv[]) {
+  size_t iters = argc > 1 ? atol(argv[1]) : 100000;
+  for (size_t len : {16, 256, 4096}) {
+    string a;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < len; ++i) {
+      seed = seed * 1103515245 + 12345;
+      a += static_cast<char16_t>(u'a' + (seed >> 16) % 26);
+    }
+    string b = a;
+    b.back() = u'#';
+    // The worst case of each search, a match at the far end.
+    string needle = a.substr(len - 8);
+    string head = a.substr(0, 8);
+    volatile size_t n = len;
+
+    printf("length %zu\n", len);
+    Run("Equal scalar", iters, [&] { return scalar::Equal(a.data(), b.data(), n); });
+    Run("Equal simd", iters, [&] { return simd::Equal(a.data(), b.data(), n); });
+    Run("Compare scalar", iters, [&] { return size_t(scalar::Compare(a.data(), n, b.data(), n) + 1); });
+    Run("Compare simd", iters, [&] { return size_t(simd::Compare(a.data(), n, b.data(), n) + 1); });
+    Run("Find scalar", iters, [&] { return scalar::Find(a.data(), n, needle.data(), needle.size()); });
+    Run("Find u16string", iters, [&] { return a.find(needle); });
+    Run("Find simd", iters, [&] { return simd::Find(a.data(), n, needle.data(), needle.size()); });
+    Run("RFind u16string", iters, [&] { return a.rfind(head); });
+    Run("RFind simd", iters, [&] { return simd::RFind(a.data(), n, head.data(), head.size()); });
+  }
+  return 0;
+}
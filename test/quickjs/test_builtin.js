@@ -65,6 +65,22 @@ function test_function()
 
     r = (function () { return 1; }).apply(null, undefined);
     assert(r, 1);
+
+    function args() { return Array.prototype.slice.call(arguments, 0); }
+    var a = [1, , 3];
+    Object.defineProperty(a, "0", { get: function () { return 5; } });
+    Array.prototype[1] = 7;
+    assert(args.apply(null, a).join(), "5,7,3", "apply holes and accessors");
+    delete Array.prototype[1];
+    a = [1, 2];
+    a.length = 4;
+    assert(args.apply(null, a).length, 4, "apply length");
+    assert(args.apply(null, { length: 2, 0: "x", 1: "y" }).join(), "x,y", "apply array-like");
+    function strict_args(x) {
+        x = 10;
+        return args.apply(null, arguments).join();
+    }
+    assert(strict_args(1, 2), "1,2", "apply strict arguments");
     
     r = new Function("a", "b", "return a + b;");
     assert(r(2,3), 5, "function");
@@ -128,6 +144,77 @@ function test()
     assert(err, true, "extensible");
 }
 
+function test_function_properties()
+{
+    var F, G, H, p, k, keys, names;
+
+    /* instanceof walks the prototype chain of the object */
+    F = function(a, b) {};
+    assert(new F() instanceof F, true, "instanceof");
+    assert(new F() instanceof Object, true, "instanceof Object");
+    assert({} instanceof F, false, "not instanceof");
+
+    /* length and prototype are own properties before any access */
+    F = function(a, b) {};
+    assert(F.hasOwnProperty("prototype"), true, "hasOwnProperty prototype");
+    F = function(a, b) {};
+    assert(F.hasOwnProperty("length"), true, "hasOwnProperty length");
+    F = function(a, b) {};
+    assert("length" in F, true, "in");
+    assert(F.length, 2, "length");
+
+    /* assigning prototype before it is created */
+    G = function() {};
+    p = {x: 1};
+    G.prototype = p;
+    assert(G.prototype, p, "assigned prototype");
+    assert(new G().x, 1, "assigned prototype new");
+    assert(Object.getPrototypeOf(new G()), p);
+
+    /* the pending properties are not enumerable */
+    H = function(a) {};
+    H.y = 2;
+    keys = [];
+    for (k in H)
+        keys.push(k);
+    assert(keys.join(), "y", "for-in");
+    assert(Object.keys(H).join(), "y", "keys");
+
+    H = function(a) {};
+    H.y = 2;
+    names = Object.getOwnPropertyNames(H);
+    assert(names.sort().join(), "length,prototype,y", "getOwnPropertyNames");
+    assert(H.prototype.constructor, H);
+}
+
+function test_builtin_this()
+{
+    var f, ts;
+
+    /* builtins called through call get the this value passed */
+    f = function() { return Array.prototype.slice.call(arguments, 1); };
+    assert(f(1, 2, 3), [2, 3], "slice arguments");
+    assert(f(1, 2, 3).length, 2);
+    assert(f(1).length, 0);
+
+    ts = Object.prototype.toString;
+    assert(ts.call([]), "[object Array]");
+    assert(ts.call({}), "[object Object]");
+    assert(ts.call(function() {}), "[object Function]");
+    assert(ts.call(new Error("x")), "[object Error]");
+    assert(ts.call(/a/), "[object RegExp]");
+    assert(ts.call(new String("s")), "[object String]");
+    assert(ts.call(null), "[object Null]");
+    assert(ts.call(undefined), "[object Undefined]");
+    assert(ts.call(1), "[object Number]");
+    assert(ts.call("s"), "[object String]");
+    f = function() { return ts.call(arguments); };
+    assert(f(), "[object Arguments]");
+
+    assert(Array.prototype.join.call({length: 2, 0: "a", 1: "b"}, "-"), "a-b");
+    assert(Object.prototype.hasOwnProperty.call({a: 1}, "a"), true);
+}
+
 function test_enum()
 {
     var a, tab;
@@ -141,7 +228,7 @@ function test_enum()
          "4294967294": 1,
          "1": 2};
     tab = Object.keys(a);
-    assert(tab, ["1","4294967294","4294967295","18014398509481984", "4294967296","9007199254740991","9007199254740992","x","y"])
+    assert(tab, ["1","4294967294","x","18014398509481984","9007199254740992","9007199254740991","4294967296","4294967295","y"])
 }
 
 function test_array()
@@ -488,6 +575,8 @@ function test_regexp()
 
 test();
 test_function();
+test_function_properties();
+test_builtin_this();
 test_enum();
 test_array();
 test_string();
@@ -252,6 +252,216 @@ function test_arguments()
     f2(1, 3);
 }
 
+function test_arguments_mapped()
+{
+    var f, g, i, params, args;
+
+    /* writes go both ways between the parameters and arguments */
+    f = function(a, b) {
+        a = 10;
+        assert(arguments[0], 10, "write param");
+        arguments[1] = 20;
+        assert(b, 20, "write arguments");
+        return arguments.length;
+    };
+    assert(f(1, 2), 2);
+
+    /* an index without an argument is not mapped */
+    f = function(a, b) {
+        arguments[1] = 5;
+        return b;
+    };
+    assert(f(1), undefined);
+
+    /* delete unmaps the index */
+    f = function(a) {
+        delete arguments[0];
+        assert(arguments[0], undefined, "deleted");
+        arguments[0] = 2;
+        assert(a, 1, "unmapped after delete");
+        a = 3;
+        return arguments[0];
+    };
+    assert(f(1), 2);
+
+    /* a non writable index keeps its value and is unmapped */
+    f = function(a) {
+        Object.defineProperty(arguments, 0, {writable: false});
+        a = 2;
+        assert(arguments[0], 1, "unmapped after defineProperty");
+        arguments[0] = 3;
+        return arguments[0];
+    };
+    assert(f(1), 1);
+
+    /* strict functions do not map */
+    f = function(a) {
+        "use strict";
+        a = 2;
+        return arguments[0];
+    };
+    assert(f(1), 1);
+
+    /* arguments escaping through a closure is still mapped after the call */
+    g = function(a) {
+        var args = arguments;
+        return [function() { return args[0]; },
+                function(v) { a = v; },
+                function(v) { args[0] = v; },
+                function() { return a; }];
+    };
+    args = g(1);
+    args[1](7);
+    assert(args[0](), 7, "escaped arguments read");
+    args[2](8);
+    assert(args[3](), 8, "escaped arguments write");
+    g = function(a) {
+        return function() { return arguments; };
+    };
+    assert(g(1)(4, 5)[1], 5);
+
+    /* more parameters than the mapped bitmask covers */
+    params = [];
+    for (i = 0; i < 70; i++)
+        params.push("p" + i);
+    f = new Function(params.join(","),
+                     "p3 = 'a'; arguments[69] = 'b'; p66 = 'c';" +
+                     "return arguments[3] + p69 + arguments[66] + arguments.length;");
+    args = [];
+    for (i = 0; i < 70; i++)
+        args.push(i);
+    assert(f.apply(null, args), "abc70");
+
+    /* apply reads the mapped indices through the parameters */
+    g = function() { return Array.prototype.slice.call(arguments, 0).join(); };
+    f = function(x, y) {
+        x = 10;
+        delete arguments[1];
+        return g.apply(null, arguments);
+    };
+    assert(f(1, 2, 3), "10,,3");
+}
+
+function test_switch()
+{
+    var log, f, i, s, calls;
+
+    /* fall through from a case before default into a later case */
+    f = function(x) {
+        log = [];
+        switch (x) {
+        case 1: log.push("a");
+        default: log.push("d");
+        case 2: log.push("b"); break;
+        case 3: log.push("c");
+        }
+        return log.join("");
+    };
+    assert(f(1), "adb");
+    assert(f(2), "b");
+    assert(f(3), "c");
+    assert(f(4), "db");
+
+    /* a case after default skips default */
+    f = function(x) {
+        log = [];
+        switch (x) {
+        case 1: log.push("a");
+        default: log.push("d");
+        case 3: log.push("c");
+        }
+        return log.join("");
+    };
+    assert(f(3), "c");
+
+    /* duplicate literals match the first one */
+    f = function(x) {
+        switch (x) {
+        case 1: return "first";
+        case 1: return "second";
+        case "s": return "s1";
+        case "s": return "s2";
+        }
+        return "none";
+    };
+    assert(f(1), "first");
+    assert(f("s"), "s1");
+
+    /* strict equality on the discriminant */
+    f = function(x) {
+        switch (x) {
+        case 0: return "zero";
+        case 1: return "one";
+        case "1": return "string one";
+        case NaN: return "nan";
+        default: return "default";
+        }
+    };
+    assert(f(1), "one");
+    assert(f("1"), "string one");
+    assert(f(new String("1")), "default");
+    assert(f(new Number(1)), "default");
+    assert(f(-0), "zero");
+    assert(f(NaN), "default");
+    assert(f(true), "default");
+    for (i = 0; i < 3; i++)
+        assert(f(i), ["zero", "one", "default"][i]);
+
+    /* non literal cases are evaluated in order until the first match */
+    calls = [];
+    s = function(v) { calls.push(v); return v; };
+    f = function(x) {
+        switch (x) {
+        case s(1): return "a";
+        case s(2): return "b";
+        case s(3): return "c";
+        default: return "d";
+        }
+    };
+    assert(f(2), "b");
+    assert(calls.join(), "1,2");
+    calls = [];
+    assert(f(5), "d");
+    assert(calls.join(), "1,2,3");
+}
+
+function test_call_order()
+{
+    var log, o, r;
+
+    function arg() { log.push("arg"); return 1; }
+    function C() { log.push("new"); }
+    o = {};
+    Object.defineProperty(o, "f", {get: function() {
+        log.push("get");
+        return function(x) { log.push("call"); return x; };
+    }});
+    Object.defineProperty(o, "C", {get: function() {
+        log.push("get");
+        return C;
+    }});
+
+    /* the callee is got before the arguments are evaluated (11.2.3) */
+    log = [];
+    r = o.f(arg());
+    assert(log.join(), "get,arg,call", "value");
+    log = [];
+    r = (o.f)(arg());
+    assert(log.join(), "get,arg,call", "parenthesized value");
+    log = [];
+    r = typeof o.f(arg());
+    assert(log.join(), "get,arg,call", "reference");
+    log = [];
+    r = delete o.f(arg());
+    assert(log.join(), "get,arg,call", "delete");
+    log = [];
+    r = new o.C(arg());
+    assert(log.join(), "get,arg,new", "new");
+    log = [];
+    r = typeof new o.C(arg());
+    assert(log.join(), "get,arg,new", "new reference");
+}
+
 function test_object_literal()
 {
     a = { get: 2, set: 3, async: 4 };
@@ -296,6 +506,9 @@ test_op2();
 test_delete();
 test_prototype();
 test_arguments();
+test_arguments_mapped();
+test_switch();
+test_call_order();
 // test_object_literal();  // JSON
 // test_regexp_skip();  // regex
 test_function_expr_name();
@@ -0,0 +1,132 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <es/parser/parser.h>
+#include <es/enter_code.h>
+#include <es/eval.h>
+#include <es/types/property_descriptor_object_conversion.h>
+#include <es/utils/hashmap_v2.h>
+#include <es/gc/heap.h>
+#include <es/impl.h>
+
+using namespace es;
+
+std::vector<Handle<String>> Keys(size_t n) {
+  std::vector<Handle<String>> keys;
+  for (size_t i = 0; i < n; ++i)
+    keys.emplace_back(String::New(u"key" + NumberToU16String(i)));
+  return keys;
+}
+
+// The builtins are singletons, so they are only initialized once.
+class TestHashMap : public testing::Test {
+ protected:
+  static void SetUpTestSuite() { Init(); }
+};
+
+TEST_F(TestHashMap, SetGetDelete) {
+  for (size_t n : {1, 3, 7, 15, 16, 100, 1000}) {
+    std::vector<Handle<String>> keys = Keys(n);
+    Handle<HashMapV2> map = HashMapV2::New();
+    Handle<String> missing = String::New(u"missing");
+    for (size_t i = 0; i < n; ++i) {
+      map = HashMapV2::Set(map, keys[i], Number::New(i));
+      // A miss needs an empty slot to stop at.
+      EXPECT_EQ(nullptr, map.val()->GetRaw(missing));
+    }
+    EXPECT_EQ(n, map.val()->occupancy());
+    for (size_t i = 0; i < n; ++i) {
+      JSValue* val = map.val()->GetRaw(keys[i]);
+      ASSERT_NE(nullptr, val);
+      EXPECT_EQ(i, static_cast<Number*>(val)->data());
+    }
+
+    for (size_t i = 0; i < n; i += 2)
+      map.val()->Delete(keys[i]);
+    EXPECT_EQ(n / 2, map.val()->occupancy());
+    for (size_t i = 0; i < n; ++i)
+      EXPECT_EQ(i % 2 == 0, map.val()->GetRaw(keys[i]) == nullptr);
+
+    // Reuse the tombstones and overwrite the remaining ones.
+    for (size_t i = 0; i < n; ++i)
+      map = HashMapV2::Set(map, keys[i], Number::New(n + i));
+    EXPECT_EQ(n, map.val()->occupancy());
+    for (size_t i = 0; i < n; ++i)
+      EXPECT_EQ(n + i, static_cast<Number*>(map.val()->GetRaw(keys[i]))->data());
+  }
+}
+
+TEST_F(TestHashMap, Churn) {
+  std::vector<Handle<String>> keys = Keys(64);
+  Handle<HashMapV2> map = HashMapV2::New();
+  // Keep inserting and deleting, so that the load is mostly tombstones.
+  for (size_t round = 0; round < 100; ++round) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      bool created;
+      map = HashMapV2::Create(map, keys[i], Number::New(round), created);
+      EXPECT_TRUE(created);
+    }
+    for (size_t i = 0; i < keys.size(); ++i)
+      map.val()->Delete(keys[i]);
+    EXPECT_EQ(0u, map.val()->occupancy());
+  }
+  EXPECT_LE(map.val()->capacity(), 256u);
+}
+
+TEST_F(TestHashMap, InsertionOrder) {
+  std::vector<Handle<String>> keys = Keys(50);
+  Handle<HashMapV2> map = HashMapV2::New();
+  for (size_t i = 0; i < keys.size(); ++i)
+    map = HashMapV2::Set(map, keys[i], Number::New(i));
+  // A deleted key goes to the end when it is set again, an overwritten
+  // one keeps its place.
+  map.val()->Delete(keys[3]);
+  map = HashMapV2::Set(map, keys[3], Number::New(3));
+  map = HashMapV2::Set(map, keys[7], Number::New(70));
+  auto all = [](HashMapV2::Entry* p) { return true; };
+  std::vector<Handle<String>> result = map.val()->Keys(all);
+  ASSERT_EQ(keys.size(), result.size());
+  EXPECT_TRUE(StringEqual(keys[0], result[0]));
+  EXPECT_TRUE(StringEqual(keys[4], result[3]));
+  EXPECT_TRUE(StringEqual(keys[7], result[6]));
+  EXPECT_TRUE(StringEqual(keys[3], result.back()));
+}
+
+TEST_F(TestHashMap, IndexOrder) {
+  Handle<JSObject> obj = Object::New();
+  // 4294967295 is not an array index and keeps its insertion order.
+  std::vector<std::u16string> names = {u"x", u"4294967295", u"7", u"y", u"4294967294", u"3"};
+  for (size_t i = 0; i < names.size(); ++i)
+    AddValueProperty(obj, names[i], Number::New(i), true, true, true);
+  std::vector<std::u16string> expected = {u"3", u"7", u"4294967294", u"x", u"4294967295", u"y"};
+  Handle<FixedArray> keys = PropertyMap::EnumerableKeys(obj);
+  ASSERT_EQ(expected.size(), keys.val()->size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(expected[i], static_cast<String*>(keys.val()->GetRaw(i))->data());
+}
+
+TEST_F(TestHashMap, EnumCache) {
+  Handle<JSObject> obj = Object::New();
+  std::vector<Handle<String>> keys = Keys(3);
+  for (size_t i = 0; i < 3; ++i)
+    AddValueProperty(obj, keys[i], Number::New(i), true, i != 1, true);
+
+  Handle<FixedArray> cached = PropertyMap::EnumerableKeys(obj);
+  ASSERT_EQ(2u, cached.val()->size());
+  EXPECT_EQ(keys[0].val(), cached.val()->GetRaw(0));
+  EXPECT_EQ(keys[2].val(), cached.val()->GetRaw(1));
+  EXPECT_EQ(cached.val(), PropertyMap::EnumerableKeys(obj).val());
+
+  // Redefining, adding and deleting keys all drop the cache.
+  PropertyMap::Set(obj, keys[1], StackPropertyDescriptor::NewDataDescriptor(Number::New(1), true, true, true));
+  Handle<FixedArray> rebuilt = PropertyMap::EnumerableKeys(obj);
+  EXPECT_NE(cached.val(), rebuilt.val());
+  ASSERT_EQ(3u, rebuilt.val()->size());
+  EXPECT_EQ(keys[1].val(), rebuilt.val()->GetRaw(1));
+  AddValueProperty(obj, String::New(u"new"), Number::New(3), true, true, true);
+  EXPECT_EQ(4u, PropertyMap::EnumerableKeys(obj).val()->size());
+  obj.val()->named_properties()->Delete(keys[0]);
+  EXPECT_EQ(3u, PropertyMap::EnumerableKeys(obj).val()->size());
+}
@@ -106,7 +106,10 @@ TEST(TestPrimitiveConversion, ToNumber) {
     // valid
     std::vector<std::pair<string, double>> vals = {
       {u" 0 ", 0}, {u" -42  ", -42}, {u"1.98", 1.98}, {u"4.e5 \t", 4.e5},
-      {u"\n0xAB ", 0xAB}, {u"", 0}
+      {u"\n0xAB ", 0xAB}, {u"", 0}, {u"0.1", 0.1}, {u"1e+3", 1000},
+      {u".5", 0.5}, {u"5.", 5}, {u"-1.5E-3", -1.5e-3}, {u"1e400", INFINITY},
+      {u"2.2250738585072011e-308", 2.2250738585072011e-308},
+      {u"9007199254740993", 9007199254740992}, {u"-Infinity", -INFINITY}
     };
     for (auto pair : vals) {
       num = ToNumber(e, String::New(pair.first));
@@ -116,7 +119,8 @@ TEST(TestPrimitiveConversion, ToNumber) {
   // NaN
   {
     vec_string vals = {
-      u"+", u"+0xAB", u"0x", u"3e", u"\n+ 10",
+      u"+", u"+0xAB", u"0x", u"3e", u"\n+ 10", u".", u"1e+", u"0xG", u"1.2.3",
+      u"infinity",
     };
     for (auto val : vals) {
       num = ToNumber(e, String::New(val));
@@ -210,9 +214,10 @@ TEST(TestPrimitiveConversion, ToString) {
     // valid
     std::vector<std::pair<double, string>> vals = {
       {0, u"0"}, {-42, u"-42"}, {1200, u"1200"}, {1.230, u"1.23"},
-      // TODO(zhuzilin) deal with this...
-      // {0.0012, u"0.0011999999999999998"},
-      // {3e50, u"3e+50"}
+      {0.0012, u"0.0012"}, {3e50, u"3e+50"}, {0.1 + 0.2, u"0.30000000000000004"},
+      {1e21, u"1e+21"}, {1e-7, u"1e-7"}, {123e-20, u"1.23e-18"}, {-0.000001, u"-0.000001"},
+      {5e-324, u"5e-324"}, {1.7976931348623157e308, u"1.7976931348623157e+308"},
+      {123456789012345680000.0, u"123456789012345680000"},
     };
     for (auto pair : vals) {
       str = ToString(e, Number::New(pair.first));
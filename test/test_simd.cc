@@ -0,0 +1,57 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <es/utils/simd.h>
+
+using namespace es;
+
+typedef std::u16string string;
+
+std::vector<string> Samples() {
+  std::vector<string> samples = {
+    u"", u"a", u"ab", u"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", u"abcdefghijklmnopq",
+    u"hello world, hello world, hello world",
+    u"你好世界你好",
+  };
+  string s;
+  for (size_t i = 0; i < 100; ++i)
+    s += static_cast<char16_t>(u'a' + (i * 7) % 5);
+  samples.emplace_back(s);
+  return samples;
+}
+
+TEST(TestSimd, Compare) {
+  std::vector<string> samples = Samples();
+  for (auto& a : samples) {
+    for (auto& b : samples) {
+      for (size_t n = 0; n <= a.size(); n += 3) {
+        string sub = a.substr(0, n);
+        int expected = b.compare(sub);
+        int res = simd::Compare(b.data(), b.size(), sub.data(), sub.size());
+        EXPECT_EQ(expected < 0, res < 0);
+        EXPECT_EQ(expected == 0, res == 0);
+        EXPECT_EQ(expected == 0, b.size() == sub.size() && simd::Equal(b.data(), sub.data(), b.size()));
+      }
+    }
+  }
+}
+
+TEST(TestSimd, Find) {
+  std::vector<string> samples = Samples();
+  for (auto& s : samples) {
+    for (size_t i = 0; i <= s.size(); ++i) {
+      for (size_t len = 0; i + len <= s.size() && len < 20; len += 1) {
+        string p = s.substr(i, len);
+        for (size_t pos = 0; pos <= s.size() + 1; pos += 5) {
+          EXPECT_EQ(s.find(p, pos), simd::Find(s.data(), s.size(), p.data(), p.size(), pos));
+          EXPECT_EQ(s.rfind(p, pos), simd::RFind(s.data(), s.size(), p.data(), p.size(), pos));
+        }
+      }
+    }
+    string missing = u"xyz";
+    EXPECT_EQ(simd::npos, simd::Find(s.data(), s.size(), missing.data(), missing.size()));
+    EXPECT_EQ(simd::npos, simd::RFind(s.data(), s.size(), missing.data(), missing.size()));
+  }
+}